@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+/// @brief analytic queueing model of HDDs
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+#include "analytic.h"
+#include "stats.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// AnalyticModel
+//
+AnalyticModel::AnalyticModel(HDD *hdd)
+  : _hdd(hdd), _invalid(0), _accuracy(0.0)
+{
+}
+
+uint64 AnalyticModel::load(TraceSource *source)
+{
+  return _trace.load(source);
+}
+
+AnalyticEstimate AnalyticModel::estimate(double rate, bool poisson)
+{
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  AnalyticEstimate e;
+  vector<double> service;
+  uint64 n = _trace.count();
+  vector<uint32> track(n), surface(n), sector(n), from, to;
+  vector<uint8>  valid(n);
+  vector<uint64> sectors;
+  vector<simtime> seek;
+  double wait = to_seconds(_hdd->wait_time());
+  double sum = 0.0, sum2 = 0.0, gap = 0.0, gap2 = 0.0;
+
+  // translate all addresses, then compute the seeks between consecutive
+  // valid requests in one batch; the head starts at track 0 like the drive's
+  _hdd->decode_batch(_trace.addresses(), n, track.data(), surface.data(),
+                     sector.data(), valid.data());
+
+  _invalid = 0;
+  for (uint64 i = 0; i < n; i++) {
+    if (((_trace.op(i) != 'r') && (_trace.op(i) != 'w')) || !valid[i]) {
+      _invalid++;
+      continue;
+    }
+
+    from.push_back(to.empty() ? 0 : to.back());
+    to.push_back(track[i]);
+    sectors.push_back(_trace.size(i) / _hdd->sector_size());
+  }
+
+  seek.resize(to.size());
+  _hdd->seek_batch(from.data(), to.data(), to.size(), seek.data());
+
+  // service times
+  service.reserve(to.size());
+  for (uint64 i = 0; i < to.size(); i++) {
+    double s = to_seconds(seek[i]) + wait +
+               to_seconds(ps_to_simtime(sectors[i] * _hdd->sector_time(to[i])));
+    service.push_back(s);
+    sum += s;
+    sum2 += s * s;
+  }
+
+  // interarrival times of the trace
+  for (uint64 i = 1; i < n; i++) {
+    double g = to_seconds(_trace.ts(i) - _trace.ts(i-1));
+    gap += g;
+    gap2 += g * g;
+  }
+
+  uint64 m = service.size();
+  double trace_rate = gap > 0.0 ? (n - 1) / gap : 0.0;
+  double mean_gap = n > 1 ? gap / (n - 1) : 0.0;
+
+  e.rate = rate > 0.0 ? rate : trace_rate;
+  e.ca2 = poisson ? 1.0 :
+          (mean_gap > 0.0 ? (gap2 / (n - 1) - mean_gap * mean_gap) / (mean_gap * mean_gap) : 0.0);
+  e.service = m > 0 ? sum / m : 0.0;
+  e.cs2 = e.service > 0.0 ? (sum2 / m - e.service * e.service) / (e.service * e.service) : 0.0;
+  e.utilization = e.rate * e.service;
+
+  if (m > 0) {
+    uint64 k = min(m - 1, (uint64)(0.99 * m));
+    nth_element(service.begin(), service.begin() + k, service.end());
+    e.service_p99 = service[k];
+  } else {
+    e.service_p99 = 0.0;
+  }
+
+  double rho = e.utilization;
+  if (rho < 1.0) {
+    e.wait = rho / (1.0 - rho) * (e.ca2 + e.cs2) / 2.0 * e.service;
+    e.mean = e.service + e.wait;
+    e.p99 = e.service_p99 + ((rho > 0.01) ? e.wait / rho * log(rho / 0.01) : 0.0);
+  } else {
+    e.wait = e.mean = e.p99 = HUGE_VAL;
+  }
+
+  e.elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  return e;
+}
+
+AnalyticValidation AnalyticModel::validate(const AnalyticEstimate &e)
+{
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+  AnalyticValidation v;
+  LatencyStats latency(_accuracy);
+  Disk *hdd = _hdd->clone();
+  uint64 n = _trace.count();
+  simtime busy = 0;
+  double span = n > 1 ? to_seconds(_trace.ts(n-1) - _trace.ts(0)) : 0.0;
+  double factor = (span > 0.0) && (e.rate > 0.0) ? e.rate / ((n - 1) / span) : 1.0;
+  double sum = 0.0;
+
+  // the drive serves one request at a time in the order of arrival
+  for (uint64 i = 0; i < n; i++) {
+    simtime arrival = _trace.arrival(i, factor);
+    simtime done = _trace.serve(hdd, i, arrival, busy);
+
+    latency.add(done - arrival);
+    sum += to_seconds(done - arrival);
+  }
+  delete hdd;
+
+  v.mean = n > 0 ? sum / n : 0.0;
+  v.p99 = to_seconds(latency.percentile(99.0));
+  v.elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  return v;
+}
+
+void AnalyticModel::print_stats(ostream &os, const AnalyticEstimate &e, bool poisson)
+{
+  os.precision(6);
+  os << "Analytic estimate (" << (poisson ? "M/G/1" : "G/G/1") << "):" << endl
+     << "  requests:                  " << dec << _trace.count() << endl
+     << "  invalid requests:          " << _invalid << endl
+     << "  arrival rate (IOPS):       " << fixed << setprecision(2) << e.rate << endl
+     << "  interarrival SCV (ca2):    " << setprecision(4) << e.ca2 << endl
+     << "  mean service time:         " << setprecision(6) << e.service << endl
+     << "  service SCV (cs2):         " << setprecision(4) << e.cs2 << endl
+     << "  p99 service time:          " << setprecision(6) << e.service_p99 << endl
+     << "  utilization:               " << setprecision(4) << e.utilization << endl;
+
+  if (e.utilization < 1.0)
+    os << "  mean queueing delay:       " << setprecision(6) << e.wait << endl
+       << "  mean latency:              " << e.mean << endl
+       << "  p99 latency:               " << e.p99 << endl;
+  else
+    os << "  the drive is saturated (utilization >= 1)" << endl;
+
+  os << "  estimation time (ms):      " << setprecision(3) << e.elapsed * 1000.0 << endl
+     << endl;
+}
+
+void AnalyticModel::print_validation(ostream &os, const AnalyticEstimate &e,
+                                     const AnalyticValidation &v)
+{
+  os.precision(6);
+  os << "Analytic validation:" << endl
+     << "                    estimate    simulation     error" << endl;
+
+  if (e.utilization < 1.0) {
+    os << "  mean latency:  " << fixed << setw(12) << e.mean << setw(14) << v.mean
+       << setw(9) << setprecision(1)
+       << (v.mean > 0.0 ? 100.0 * (e.mean - v.mean) / v.mean : 0.0) << "%" << endl
+       << setprecision(6)
+       << "  p99 latency:   " << setw(12) << e.p99 << setw(14) << v.p99
+       << setw(9) << setprecision(1)
+       << (v.p99 > 0.0 ? 100.0 * (e.p99 - v.p99) / v.p99 : 0.0) << "%" << endl;
+  } else {
+    os << "  mean latency:  " << fixed << setw(12) << "saturated" << setw(14) << v.mean << endl
+       << "  p99 latency:   " << setw(12) << "saturated" << setw(14) << v.p99 << endl;
+  }
+
+  os << "  time (ms):     " << setw(12) << setprecision(3) << e.elapsed * 1000.0
+     << setw(14) << v.elapsed * 1000.0 << endl
+     << endl;
+}
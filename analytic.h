@@ -0,0 +1,149 @@
+//------------------------------------------------------------------------------
+/// @brief analytic queueing model of HDDs
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_ANALYTIC_H__
+#define __CA_ANALYTIC_H__
+
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+#include "hdd.h"
+#include "trace_memory.h"
+#include "trace_source.h"
+using namespace std;
+
+///@brief latency prediction of the analytic model
+typedef struct _analytic_estimate {
+  double rate;                      ///< arrival rate (requests/second)
+  double ca2;                       ///< squared coefficient of variation of
+                                    ///< the interarrival times
+  double service;                   ///< mean service time (seconds)
+  double cs2;                       ///< squared coefficient of variation of
+                                    ///< the service times
+  double service_p99;               ///< 99th percentile service time (s)
+  double utilization;               ///< utilization (rate * service)
+  double wait;                      ///< mean queueing delay (seconds)
+  double mean;                      ///< mean latency (seconds)
+  double p99;                       ///< 99th percentile latency (seconds)
+  double elapsed;                   ///< time to compute the estimate (s)
+} AnalyticEstimate;
+
+///@brief latencies of the full simulation of the same requests
+typedef struct _analytic_validation {
+  double mean;                      ///< mean latency (seconds)
+  double p99;                       ///< 99th percentile latency (seconds)
+  double elapsed;                   ///< time to simulate (seconds)
+} AnalyticValidation;
+
+//------------------------------------------------------------------------------
+/// @brief analytic latency estimate for an HDD
+///
+/// AnalyticModel predicts the latency of a request stream on an HDD without
+/// simulating the queue. The service time of every request is derived from
+/// the drive model: the seek time over the distance from the previous
+/// request (the drive serves the requests in order), the average rotational
+/// latency and the transfer time of the request on its track. The moments of
+/// the service and interarrival times are then put into a single-server
+/// queueing approximation:
+///
+///   M/G/1 (Pollaczek-Khinchine):  W = rho / (1 - rho) * (1 + cs2) / 2 * S
+///   G/G/1 (Kingman):              W = rho / (1 - rho) * (ca2 + cs2) / 2 * S
+///
+/// The tail assumes an exponential queueing delay that is non-zero with
+/// probability rho: p99 = S_p99 + W / rho * ln(rho / 0.01). The estimate
+/// can be validated against a full simulation of the same requests in which
+/// the drive serves one request at a time in the order of arrival.
+///
+class AnalyticModel {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param hdd drive model (not owned, not modified)
+    AnalyticModel(HDD *hdd);
+
+    /// @brief destructor
+    ~AnalyticModel(void) {};
+
+    /// @}
+
+
+    /// @name estimation
+    /// @{
+
+    /// @brief read the requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief keep the simulated latencies of validate() in a sketch of
+    ///        relative accuracy @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha) { _accuracy = alpha; };
+
+    /// @brief estimate the latencies at arrival rate @a rate
+    /// @param rate arrival rate (requests/second), 0 for the rate of the
+    ///        trace. Other rates scale the interarrival times uniformly.
+    /// @param poisson true for M/G/1 (Poisson arrivals), false for G/G/1
+    ///        with the interarrival variability of the trace
+    /// @retval estimate
+    AnalyticEstimate estimate(double rate, bool poisson);
+
+    /// @brief simulate the requests at the rate of @a e on a copy of the drive
+    /// @retval simulated latencies
+    AnalyticValidation validate(const AnalyticEstimate &e);
+
+    /// @brief print an estimate
+    /// @param os output stream
+    /// @param e estimate
+    /// @param poisson model used for @a e
+    void   print_stats(ostream &os, const AnalyticEstimate &e, bool poisson);
+
+    /// @brief print the comparison of an estimate with the simulation
+    /// @param os output stream
+    /// @param e estimate
+    /// @param v simulated latencies
+    void   print_validation(ostream &os, const AnalyticEstimate &e,
+                            const AnalyticValidation &v);
+
+    /// @}
+
+
+  protected:
+    HDD   *_hdd;                    ///< drive model
+    MemoryTrace _trace;             ///< requests
+    uint64 _invalid;                ///< requests beyond the capacity
+    double _accuracy;               ///< accuracy of the simulated latencies
+};
+
+#endif // __CA_ANALYTIC_H__
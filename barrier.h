@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+/// @brief reusable spinning barrier
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_BARRIER_H__
+#define __CA_BARRIER_H__
+
+#include <atomic>
+
+#include "disk.h"
+#include "spsc.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief barrier for a fixed number of threads
+///
+/// Barrier blocks each of @a count threads in wait() until all of them have
+/// arrived. The last thread to arrive starts a new generation, which releases
+/// the others and makes the barrier ready for the next round. Writes made
+/// before wait() are visible to all threads after it.
+///
+class Barrier {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param count number of participating threads
+    Barrier(uint32 count) : _count(count), _waiting(0), _generation(0) {};
+
+    /// @brief destructor
+    ~Barrier(void) {};
+
+    /// @}
+
+
+    /// @name synchronization
+    /// @{
+
+    /// @brief wait until all threads have arrived
+    void   wait(void);
+
+    /// @}
+
+
+  protected:
+    uint32 _count;                  ///< number of participating threads
+    atomic<uint32> _waiting;        ///< threads arrived in this generation
+    atomic<uint32> _generation;     ///< number of completed rounds
+};
+
+
+//------------------------------------------------------------------------------
+// Barrier
+//
+inline void Barrier::wait(void)
+{
+  uint32 generation = _generation.load(memory_order_acquire);
+
+  if (_waiting.fetch_add(1, memory_order_acq_rel) + 1 == _count) {
+    _waiting.store(0, memory_order_relaxed);
+    _generation.fetch_add(1, memory_order_acq_rel);
+  } else {
+    for (uint32 spins = 0; _generation.load(memory_order_acquire) == generation; spins++)
+      spin_wait(spins);
+  }
+}
+
+#endif // __CA_BARRIER_H__
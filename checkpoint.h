@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+/// @brief binary checkpoint encoding
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_CHECKPOINT_H__
+#define __CA_CHECKPOINT_H__
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "disk.h"
+using namespace std;
+
+// checkpoint file signature and format version
+#define CKPT_MAGIC    "CKPT"
+#define CKPT_VERSION  4
+
+// largest vector read from a stream that cannot tell its length (bytes)
+#define CKPT_MAX_UNSEEKABLE  (1ULL << 32)
+
+//------------------------------------------------------------------------------
+// Checkpoints are a sequence of fixed-size values in host byte order. Every
+// device starts its state with a four-character tag so that a checkpoint
+// cannot be loaded into a differently composed device.
+//
+
+/// @brief write a value of fixed size
+template <class T>
+inline void ckpt_put(ostream &os, const T &value)
+{
+  os.write((const char*)&value, sizeof(T));
+}
+
+/// @brief read a value of fixed size
+/// @retval true on success, false at the end of the checkpoint
+template <class T>
+inline bool ckpt_get(istream &is, T &value)
+{
+  is.read((char*)&value, sizeof(T));
+  return is.good();
+}
+
+/// @brief write a vector of fixed-size values
+template <class T>
+inline void ckpt_put(ostream &os, const vector<T> &values)
+{
+  ckpt_put(os, (uint64)values.size());
+  if (!values.empty())
+    os.write((const char*)&values[0], values.size() * sizeof(T));
+}
+
+/// @brief number of bytes left in @a is (CKPT_MAX_UNSEEKABLE if the stream
+///        cannot tell)
+inline uint64 ckpt_remaining(istream &is)
+{
+  streampos pos = is.tellg();
+  if (pos < 0)
+    return CKPT_MAX_UNSEEKABLE;
+
+  is.seekg(0, ios::end);
+  streampos end = is.tellg();
+  is.seekg(pos);
+
+  return end > pos ? (uint64)(end - pos) : 0;
+}
+
+/// @brief read a vector of fixed-size values
+/// @retval true on success, false at the end of the checkpoint or if the
+///         stored size exceeds the rest of the checkpoint
+template <class T>
+inline bool ckpt_get(istream &is, vector<T> &values)
+{
+  uint64 size;
+
+  if (!ckpt_get(is, size))
+    return false;
+
+  // a corrupt size must not turn into a huge allocation
+  if (size > ckpt_remaining(is) / sizeof(T)) {
+    is.setstate(ios::failbit);
+    return false;
+  }
+
+  values.resize(size);
+  if (size > 0)
+    is.read((char*)&values[0], size * sizeof(T));
+
+  return is.good();
+}
+
+/// @brief write the tag of a device
+inline void ckpt_put_tag(ostream &os, const char *tag)
+{
+  os.write(tag, 4);
+}
+
+/// @brief read and check the tag of a device
+/// @retval true if the checkpoint continues with @a tag, false otherwise
+inline bool ckpt_get_tag(istream &is, const char *tag)
+{
+  char t[4];
+
+  is.read(t, 4);
+  if (!is.good() || (memcmp(t, tag, 4) != 0)) {
+    cout << "Error: checkpoint does not match the simulated device (expected '"
+         << string(tag, 4) << "')" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+/// @brief read a value and compare it with the configured @a expected value
+/// @param what description of the value for the error message
+/// @retval true if the values match, false otherwise
+template <class T>
+inline bool ckpt_check(istream &is, const T &expected, const char *what)
+{
+  T value;
+
+  if (!ckpt_get(is, value) || (value != expected)) {
+    cout << "Error: checkpoint was taken with a different " << what << endl;
+    return false;
+  }
+
+  return true;
+}
+
+#endif // __CA_CHECKPOINT_H__
@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+/// @brief closed-loop workload with outstanding-I/O clients
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <sstream>
+
+#include "closed_loop.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// ClosedLoop
+//
+ClosedLoop::ClosedLoop(Disk *device, simtime think)
+  : _device(device), _think(think > 0 ? think : 0), _saved(false)
+{
+}
+
+uint64 ClosedLoop::load(TraceSource *source)
+{
+  return _trace.load(source);
+}
+
+bool ClosedLoop::run(uint32 clients, ClosedLoopResult &res)
+{
+  typedef pair<simtime, uint32> Issue;  ///< next request of a client
+  priority_queue<Issue, vector<Issue>, greater<Issue> > issues;
+  simtime busy = 0, last = 0;
+  uint64 n = _trace.count();
+
+  // every run starts from the initial state of the device
+  if (!_saved) {
+    ostringstream os;
+    if (!_device->save(os))
+      return false;
+    _snapshot = os.str();
+    _saved = true;
+  } else {
+    istringstream is(_snapshot);
+    if (!_device->load(is))
+      return false;
+  }
+  _device->reset_stats();
+  _latency.reset();
+
+  if (clients == 0) clients = 1;
+  for (uint32 c = 0; c < clients; c++)
+    issues.push(Issue(0, c));
+
+  // requests are handed out in trace order to the client that issues next;
+  // the device serves them in the order of arrival
+  for (uint64 i = 0; i < n; i++) {
+    Issue next = issues.top();
+    issues.pop();
+
+    simtime done = _trace.serve(_device, i, next.first, busy);
+
+    last = max(last, done);
+    _latency.add(done - next.first);
+    issues.push(Issue(done + _think, next.second));
+  }
+
+  res.clients = clients;
+  res.requests = n;
+  res.throughput = last > 0 ? n / to_seconds(last) : 0.0;
+  res.mean = _latency.mean();
+  res.p99 = _latency.percentile(99.0);
+
+  return true;
+}
+
+bool ClosedLoop::sweep(uint32 max_clients, ostream &os)
+{
+  vector<ClosedLoopResult> results;
+  uint32 knee = 0, peak = 0;
+  double power = -1.0;
+
+  if (max_clients == 0) max_clients = 1;
+  for (uint32 c = 1; ; c = min(2 * c, max_clients)) {
+    ClosedLoopResult r;
+    if (!run(c, r))
+      return false;
+    results.push_back(r);
+    if (c == max_clients) break;
+  }
+
+  os.precision(6);
+  os << "Closed-loop statistics:" << endl
+     << "  requests per run:          " << dec << _trace.count() << endl
+     << "  think time:                " << fixed << to_seconds(_think) << endl
+     << "  clients        IOPS  mean latency   p99 latency" << endl;
+
+  for (uint32 k = 0; k < results.size(); k++) {
+    const ClosedLoopResult &r = results[k];
+    double p = r.mean > 0.0 ? r.throughput / r.mean : 0.0;
+
+    if (p > power) {
+      power = p;
+      knee = k;
+    }
+    if (r.throughput > results[peak].throughput) peak = k;
+
+    os << "  " << setw(7) << r.clients
+       << setw(12) << setprecision(2) << r.throughput
+       << setw(14) << setprecision(6) << r.mean
+       << setw(14) << to_seconds(r.p99) << endl;
+  }
+
+  os << "  saturation throughput:     " << setprecision(2) << results[peak].throughput
+     << " IOPS" << endl
+     << "  knee:                      " << results[knee].clients << " clients ("
+     << setprecision(2) << results[knee].throughput << " IOPS, "
+     << setprecision(6) << results[knee].mean << " s)" << endl
+     << endl;
+
+  return true;
+}
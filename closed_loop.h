@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+/// @brief closed-loop workload with outstanding-I/O clients
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_CLOSED_LOOP_H__
+#define __CA_CLOSED_LOOP_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "disk.h"
+#include "stats.h"
+#include "trace_memory.h"
+#include "trace_source.h"
+using namespace std;
+
+///@brief result of a closed-loop run
+typedef struct _closed_loop_result {
+  uint32 clients;                   ///< number of clients
+  uint64 requests;                  ///< requests served
+  double throughput;                ///< requests per second
+  double mean;                      ///< mean latency (seconds)
+  simtime p99;                      ///< 99th percentile latency
+} ClosedLoopResult;
+
+//------------------------------------------------------------------------------
+/// @brief closed-loop workload
+///
+/// In a closed loop, each of N clients issues its next request only after
+/// its previous request has completed and a think time has passed, so the
+/// offered load adapts to the speed of the device. The requests (operation,
+/// address and size) are taken from a trace or a generator in order; their
+/// timestamps are ignored. The device serves one request at a time in the
+/// order of arrival.
+///
+/// A sweep runs the same requests with 1, 2, 4, ... clients, each time from
+/// the initial state of the device, and reports throughput and latency per
+/// client count. The saturation knee is the client count that maximizes
+/// the power (throughput / mean latency): beyond it, additional clients
+/// mostly add queueing delay.
+///
+class ClosedLoop {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param device device to simulate (not owned)
+    /// @param think think time between a completion and the next request of
+    ///        the same client
+    ClosedLoop(Disk *device, simtime think);
+
+    /// @brief destructor
+    ~ClosedLoop(void) {};
+
+    /// @}
+
+
+    /// @name simulation
+    /// @{
+
+    /// @brief read the requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief keep the latencies of a run in a sketch of relative accuracy
+    ///        @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha) { _latency.set_accuracy(alpha); };
+
+    /// @brief run all requests with @a clients clients from the initial state
+    ///        of the device
+    /// @param clients number of clients
+    /// @param res (output) throughput and latency of the run
+    /// @retval true on success, false if the state of the device cannot be
+    ///         saved or restored
+    bool   run(uint32 clients, ClosedLoopResult &res);
+
+    /// @brief run with 1, 2, 4, ... and @a max_clients clients and print the
+    ///        results and the saturation knee
+    /// @param max_clients largest number of clients
+    /// @param os output stream
+    /// @retval true on success, false otherwise
+    bool   sweep(uint32 max_clients, ostream &os);
+
+    /// @}
+
+
+  protected:
+    Disk  *_device;                 ///< simulated device
+    simtime _think;                 ///< think time
+    MemoryTrace _trace;             ///< requests
+    string _snapshot;               ///< initial state of the device
+    bool   _saved;                  ///< true once _snapshot is taken
+    LatencyStats _latency;          ///< latencies of the current run
+};
+
+#endif // __CA_CLOSED_LOOP_H__
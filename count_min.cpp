@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+/// @brief count-min sketch with heavy hitters
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+
+#include "count_min.h"
+#include "checkpoint.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// CountMinSketch
+//
+CountMinSketch::CountMinSketch(uint32 k, uint32 width, uint32 depth)
+  : _k(k), _candidates(k * COUNT_MIN_CANDIDATES),
+    _width(width > 0 ? width : 1), _depth(depth > 0 ? depth : 1), _total(0)
+{
+  _counters.assign((uint64)_width * _depth, 0);
+}
+
+void CountMinSketch::add(uint64 key, uint64 n)
+{
+  uint64 estimate = 0;
+
+  for (uint32 r = 0; r < _depth; r++) {
+    uint64 &c = _counters[slot(key, r)];
+    c += n;
+    if ((r == 0) || (c < estimate)) estimate = c;
+  }
+  _total += n;
+
+  offer(key, estimate);
+}
+
+bool CountMinSketch::merge(const CountMinSketch &other)
+{
+  if ((other._width != _width) || (other._depth != _depth)) {
+    cout << "Error: cannot merge count-min sketches of different dimensions" << endl;
+    return false;
+  }
+
+  for (uint64 i = 0; i < _counters.size(); i++)
+    _counters[i] += other._counters[i];
+  _total += other._total;
+
+  // re-estimate the heavy hitters of both sketches on the merged counters
+  vector<uint64> keys;
+  map<uint64, uint64>::const_iterator it;
+  for (it = _heavy.begin(); it != _heavy.end(); it++) keys.push_back(it->first);
+  for (it = other._heavy.begin(); it != other._heavy.end(); it++) keys.push_back(it->first);
+
+  _heavy.clear();
+  _order.clear();
+  for (uint64 i = 0; i < keys.size(); i++)
+    offer(keys[i], estimate(keys[i]));
+
+  return true;
+}
+
+uint64 CountMinSketch::estimate(uint64 key) const
+{
+  uint64 estimate = 0;
+
+  for (uint32 r = 0; r < _depth; r++) {
+    uint64 c = _counters[slot(key, r)];
+    if ((r == 0) || (c < estimate)) estimate = c;
+  }
+
+  return estimate;
+}
+
+vector<pair<uint64, uint64> > CountMinSketch::top(void) const
+{
+  // the estimates of the candidates grow with the counts of colliding keys
+  // after they were last offered
+  vector<pair<uint64, uint64> > top;
+  map<uint64, uint64>::const_iterator it;
+
+  for (it = _heavy.begin(); it != _heavy.end(); it++)
+    top.push_back(make_pair(estimate(it->first), it->first));
+
+  sort(top.begin(), top.end(), greater<pair<uint64, uint64> >());
+  if (top.size() > _k) top.resize(_k);
+
+  return top;
+}
+
+void CountMinSketch::save(ostream &os) const
+{
+  vector<uint64> heavy;
+  map<uint64, uint64>::const_iterator it;
+
+  for (it = _heavy.begin(); it != _heavy.end(); it++)
+    heavy.push_back(it->first);
+
+  ckpt_put(os, _k);
+  ckpt_put(os, _width);
+  ckpt_put(os, _depth);
+  ckpt_put(os, _total);
+  ckpt_put(os, _counters);
+  ckpt_put(os, heavy);
+}
+
+bool CountMinSketch::load(istream &is)
+{
+  vector<uint64> heavy;
+
+  if (!ckpt_get(is, _k) || !ckpt_get(is, _width) || !ckpt_get(is, _depth) ||
+      !ckpt_get(is, _total) || !ckpt_get(is, _counters) || !ckpt_get(is, heavy) ||
+      (_counters.size() != (uint64)_width * _depth))
+    return false;
+  _candidates = _k * COUNT_MIN_CANDIDATES;
+
+  _heavy.clear();
+  _order.clear();
+  for (uint64 i = 0; i < heavy.size(); i++)
+    offer(heavy[i], estimate(heavy[i]));
+
+  return true;
+}
+
+uint64 CountMinSketch::slot(uint64 key, uint32 row) const
+{
+  // finalizer of splitmix64 with a different seed per row
+  uint64 h = key + (row + 1) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  h = h ^ (h >> 31);
+
+  return (uint64)row * _width + h % _width;
+}
+
+void CountMinSketch::offer(uint64 key, uint64 n)
+{
+  if (_candidates == 0) return;
+
+  map<uint64, uint64>::iterator it = _heavy.find(key);
+  if (it != _heavy.end()) {
+    _order.erase(make_pair(it->second, key));
+    it->second = n;
+    _order.insert(make_pair(n, key));
+    return;
+  }
+
+  // refresh the stale estimate of the weakest candidate before evicting it
+  while (_heavy.size() >= _candidates) {
+    pair<uint64, uint64> weakest = *_order.begin();
+    uint64 current = estimate(weakest.second);
+
+    if (current != weakest.first) {
+      _order.erase(_order.begin());
+      _order.insert(make_pair(current, weakest.second));
+      _heavy[weakest.second] = current;
+    } else if (n > current) {
+      _order.erase(_order.begin());
+      _heavy.erase(weakest.second);
+    } else {
+      return;
+    }
+  }
+
+  _heavy[key] = n;
+  _order.insert(make_pair(n, key));
+}
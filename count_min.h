@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+/// @brief count-min sketch with heavy hitters
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_COUNT_MIN_H__
+#define __CA_COUNT_MIN_H__
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "disk.h"
+using namespace std;
+
+// default dimensions: with width w and depth d, an estimate exceeds the
+// true count by more than 2/w of all counts with probability 2^-d
+#define COUNT_MIN_WIDTH  4096
+#define COUNT_MIN_DEPTH  4
+
+// candidate heavy hitters kept per reported one: keys whose counts are split
+// between merged sketches rank low in each part and would otherwise be lost
+#define COUNT_MIN_CANDIDATES  4
+
+//------------------------------------------------------------------------------
+/// @brief count-min sketch that tracks the most frequent keys
+///
+/// CountMinSketch estimates the number of occurrences of every key in
+/// constant memory: each of @a depth rows of @a width counters counts the
+/// keys hashing to a counter, and the estimate of a key is the smallest of
+/// its counters. Estimates never undercount. In addition, the sketch keeps
+/// COUNT_MIN_CANDIDATES * @a k candidate keys with large estimates and
+/// reports the @a k of them with the largest current estimates (heavy
+/// hitters). An update costs O(depth + log k). Sketches of the same
+/// dimensions merge by adding their counters.
+///
+class CountMinSketch {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param k number of heavy hitters to track
+    /// @param width counters per row
+    /// @param depth number of rows
+    CountMinSketch(uint32 k=10, uint32 width=COUNT_MIN_WIDTH, uint32 depth=COUNT_MIN_DEPTH);
+
+    /// @brief destructor
+    ~CountMinSketch(void) {};
+
+    /// @}
+
+
+    /// @name accumulation
+    /// @{
+
+    /// @brief count @a n occurrences of @a key
+    void   add(uint64 key, uint64 n=1);
+
+    /// @brief add the counts of @a other
+    /// @retval true on success, false if the dimensions differ
+    bool   merge(const CountMinSketch &other);
+
+    /// @}
+
+
+    /// @name queries
+    /// @{
+
+    /// @brief total number of occurrences
+    uint64 total(void) const { return _total; };
+
+    /// @brief counters per row
+    uint32 width(void) const { return _width; };
+
+    /// @brief number of rows
+    uint32 depth(void) const { return _depth; };
+
+    /// @brief estimated number of occurrences of @a key
+    uint64 estimate(uint64 key) const;
+
+    /// @brief heavy hitters, most frequent first, with their current
+    ///        estimates
+    /// @retval pairs of (estimated count, key)
+    vector<pair<uint64, uint64> > top(void) const;
+
+    /// @}
+
+
+    /// @name serialization
+    /// @{
+
+    /// @brief write the sketch to a binary stream
+    void   save(ostream &os) const;
+
+    /// @brief read a sketch written by save()
+    /// @retval true on success, false otherwise
+    bool   load(istream &is);
+
+    /// @}
+
+
+  protected:
+    uint32 _k;                      ///< number of heavy hitters
+    uint32 _candidates;             ///< number of candidate heavy hitters
+    uint32 _width;                  ///< counters per row
+    uint32 _depth;                  ///< number of rows
+    vector<uint64> _counters;       ///< rows of counters
+    uint64 _total;                  ///< total number of occurrences
+    map<uint64, uint64> _heavy;     ///< candidates and their estimates when
+                                    ///< last offered (lower bounds)
+    set<pair<uint64, uint64> > _order; ///< candidates by estimate
+
+
+    /// @brief counter of @a key in @a row
+    uint64 slot(uint64 key, uint32 row) const;
+
+    /// @brief update the candidates with the estimate @a n of @a key
+    void   offer(uint64 key, uint64 n);
+};
+
+#endif // __CA_COUNT_MIN_H__
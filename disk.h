@@ -33,12 +33,58 @@
 #ifndef __CA_DISK_H__
 #define __CA_DISK_H__
 
+#include <iostream>
+using namespace std;
+
 //------------------------------------------------------------------------------
 // a few useful type definitions
 typedef unsigned long long uint64;        ///< 64-bit unsigned int
 typedef          long long  int64;        ///< 64-bit signed int
 typedef unsigned int       uint32;        ///< 32-bit unsigned int
 typedef          int        int32;        ///< 32-bit signed int
+typedef unsigned char      uint8;         ///< 8-bit unsigned int
+
+//------------------------------------------------------------------------------
+// simulated time
+//
+// All timestamps and latencies are integer nanoseconds. Time arithmetic is
+// exact and reproducible; conversions from/to seconds happen only when
+// reading traces and printing results.
+typedef int64 simtime;                    ///< simulated time (nanoseconds)
+
+#define NS_PER_SEC 1000000000LL           ///< nanoseconds per second
+#define PS_PER_NS  1000LL                 ///< picoseconds per nanosecond
+
+/// @brief convert seconds to simulated time (rounded to the nearest ns)
+inline simtime to_simtime(double seconds)
+{
+  double ns = seconds * NS_PER_SEC;
+  return (simtime)(ns < 0.0 ? ns - 0.5 : ns + 0.5);
+}
+
+/// @brief convert simulated time to seconds
+inline double to_seconds(simtime t)
+{
+  return (double)t / NS_PER_SEC;
+}
+
+/// @brief convert a duration in picoseconds to simulated time (rounded)
+inline simtime ps_to_simtime(int64 ps)
+{
+  return (ps + PS_PER_NS/2) / PS_PER_NS;
+}
+
+///@brief batch of requests in struct-of-arrays layout. Operations are 'r'
+///       (read) or 'w' (write); requests with other operations complete
+///       at their timestamp.
+typedef struct _disk_batch {
+  uint64 count;                     ///< number of requests
+  const simtime *ts;                ///< timestamps of the requests
+  const char   *op;                 ///< operations ('r'/'w')
+  const uint64 *address;            ///< starting addresses (bytes)
+  const uint64 *size;               ///< sizes (bytes)
+  simtime *done;                    ///< (output) completion times
+} DiskBatch;
 
 //------------------------------------------------------------------------------
 /// @brief base class for disk-based storage devices
@@ -57,6 +103,17 @@ class Disk {
     /// @brief destructor
     virtual ~Disk(void) {};
 
+    /// @brief independent copy of the device in its current state, owned by
+    ///        the caller
+    /// @retval copy, or NULL if the device cannot be copied
+    virtual Disk* clone(void) const { return NULL; };
+
+    /// @brief scale the capacity-dependent parameters (e.g., cache sizes)
+    ///        by @a rate to simulate a spatially sampled workload. Must be
+    ///        called before the first access.
+    /// @param rate sampling rate in (0, 1]
+    virtual void scale_capacity(double /*rate*/) {};
+
     /// @}
 
 
@@ -68,14 +125,70 @@ class Disk {
     /// @param adr starting address (in bytes) of data to read
     /// @param size number of bytes to read
     /// @retval time when the access ends (ts + latency of access)
-    virtual double read(double time, uint64 adr, uint64 size) = 0;
+    virtual simtime read(simtime time, uint64 adr, uint64 size) = 0;
 
     /// @brief write @a size bytes to @a adr
     /// @param time time of the event
     /// @param adr starting address (in bytes) of data to write
     /// @param size number of bytes to write
     /// @retval time when the access ends (ts + latency of access)
-    virtual double write(double time, uint64 adr, uint64 size) = 0;
+    virtual simtime write(simtime time, uint64 adr, uint64 size) = 0;
+
+    /// @brief process a batch of requests in order
+    /// @param batch requests; completion times are stored in batch.done
+    virtual void process(const DiskBatch &batch)
+    {
+      for (uint64 i = 0; i < batch.count; i++) {
+        switch (batch.op[i]) {
+          case 'r': batch.done[i] = read(batch.ts[i], batch.address[i], batch.size[i]); break;
+          case 'w': batch.done[i] = write(batch.ts[i], batch.address[i], batch.size[i]); break;
+          default : batch.done[i] = batch.ts[i];
+        }
+      }
+    };
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief discard the statistics collected so far without changing the
+    ///        state of the device (e.g., at the end of a warm-up period)
+    virtual void reset_stats(void) {};
+
+    /// @brief keep latency distributions in quantile sketches of relative
+    ///        accuracy @a alpha instead of keeping every latency (see
+    ///        LatencyStats). Must be called before the first access.
+    /// @param alpha relative accuracy (0: keep every latency)
+    virtual void set_accuracy(double /*alpha*/) {};
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the dynamic state of the device (positions, queues,
+    ///        caches, statistics) to a binary checkpoint. Devices that do
+    ///        not override it cannot be checkpointed.
+    /// @param os checkpoint stream
+    /// @retval true on success, false otherwise
+    virtual bool save(ostream & /*os*/)
+    {
+      cout << "Error: checkpoints are not supported on this device" << endl;
+      return false;
+    };
+
+    /// @brief restore the state written by save() into a device of the same
+    ///        configuration
+    /// @param is checkpoint stream
+    /// @retval true on success, false otherwise
+    virtual bool load(istream & /*is*/)
+    {
+      cout << "Error: checkpoints are not supported on this device" << endl;
+      return false;
+    };
 
     /// @}
 };
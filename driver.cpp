@@ -1,102 +1,963 @@
 #include <cassert>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <vector>
 
+#include "analytic.h"
 #include "disk.h"
 #include "hdd.h"
+#include "ssd.h"
+#include "hybrid.h"
+#include "multihdd.h"
+#include "raid0.h"
+#include "fixedhdd.h"
+#include "hdd_models.h"
+#include "closed_loop.h"
+#include "load_sweep.h"
+#include "mrc.h"
+#include "replay.h"
+#include "sampling_report.h"
+#include "shard.h"
+#include "time_series.h"
+#include "trace_index.h"
+#include "trace_merge.h"
+#include "trace_reorder.h"
+#include "trace_sample.h"
+#include "trace_sketch.h"
+#include "trace_synthetic.h"
 using namespace std;
 
-int main(void)
+// parameters of the SSD used as the fast tier of a hybrid device
+#define SSD_READ_LATENCY   0.000025 ///< 25us per read
+#define SSD_WRITE_LATENCY  0.000050 ///< 50us per write
+#define SSD_BANDWIDTH      500.0e6  ///< 500 MB/s
+
+template <class D>
+void standard_tests(D *hdd, uint32 tracks_per_surface)
+{
+  simtime t;
+
+  cout.precision(6);
+  t = hdd->seek_time(0, tracks_per_surface/2);
+  cout << "avg. seek time:    " << dec << fixed << to_seconds(t) << endl;
+
+  t = hdd->seek_time(0, 1);
+  cout << "seek 1 track:      " << dec << fixed << to_seconds(t) << endl;
+
+  t = hdd->wait_time();
+  cout << "avg. rot. latency: " << dec << fixed << to_seconds(t) << endl;
+
+  t = hdd->read_time(1);
+  cout << "read 1 sector:     " << dec << fixed << to_seconds(t) << endl;
+
+  t = hdd->write_time(1);
+  cout << "write 1 sector:    " << dec << fixed << to_seconds(t) << endl;
+
+  cout << endl << endl;
+}
+
+///@brief options of a trace replay
+typedef struct _replay_options {
+  bool   verbose;                   ///< toggle verbose output
+  bool   pipeline;                  ///< parse, simulate and print on threads
+  const char *checkpoint;           ///< prefix of checkpoint files (or NULL)
+  double checkpoint_interval;       ///< simulated seconds between checkpoints
+  const char *restore;              ///< checkpoint to resume from (or NULL)
+  const char *trace;                ///< name of the input file (or NULL)
+  bool   window;                    ///< replay only a time window
+  double window_start;              ///< start of the window (seconds)
+  double window_end;                ///< end of the window (seconds)
+  double warmup;                    ///< warm-up period before the window
+  TraceSource *source;              ///< source of the requests (or NULL)
+  TraceSketch *sketch;              ///< summary of the requests (or NULL)
+  TimeSeries *series;               ///< metrics per interval (or NULL)
+  double accuracy;                  ///< accuracy of the latencies (0: exact)
+} ReplayOptions;
+
+template <class D>
+bool replay_trace(D *device, istream &in, ostream &out, const ReplayOptions &options)
+{
+  Replay<D> replay(device, options.verbose, options.pipeline);
+
+  if (options.checkpoint != NULL)
+    replay.set_checkpoints(options.checkpoint, to_simtime(options.checkpoint_interval));
+
+  if ((options.restore != NULL) && !replay.restore(options.restore, in))
+    return false;
+
+  // start close to the warm-up period; the replay skips the remaining
+  // earlier requests
+  if (options.window) {
+    TraceIndex index;
+    simtime start = to_simtime(options.window_start);
+    simtime warmup = to_simtime(options.warmup);
+
+    if (!index.open(options.trace, (int64)in.tellg()))
+      return false;
+
+    in.seekg(index.offset(start - warmup));
+    replay.set_window(start, to_simtime(options.window_end), warmup);
+  }
+
+  replay.set_accuracy(options.accuracy);
+  replay.set_source(options.source);
+  replay.set_sketch(options.sketch);
+  replay.set_series(options.series);
+  replay.run(in, out);
+  replay.print_stats(out);
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// drive models with compile-time geometry, selectable by name
+//
+template <class M>
+Disk* create_fixed(bool verbose)
+{
+  FixedHDD<M> *hdd = new FixedHDD<M>(verbose);
+
+  standard_tests(hdd, hdd->tracks());
+
+  return hdd;
+}
+
+template <class M>
+bool replay_fixed(Disk *hdd, istream &in, ostream &out, const ReplayOptions &options)
+{
+  return replay_trace(static_cast<FixedHDD<M>*>(hdd), in, out, options);
+}
+
+typedef struct _drive_model {
+  const char *name;                 ///< name of the model
+  Disk* (*create)(bool verbose);    ///< create the drive and run the standard
+                                    ///< tests on it
+  bool (*replay)(Disk *hdd, istream &in, ostream &out,
+                 const ReplayOptions &options);
+                                    ///< replay a trace on a drive created by
+                                    ///< create (without virtual dispatch)
+} DriveModel;
+
+static const DriveModel models[] = {
+  { Desktop7200::name(),   create_fixed<Desktop7200>,   replay_fixed<Desktop7200>   },
+  { Enterprise15K::name(), create_fixed<Enterprise15K>, replay_fixed<Enterprise15K> },
+  { NULL,                  NULL,                        NULL                        }
+};
+
+void usage(const char *prog)
+{
+  cout << "usage: " << prog << " [options] < input" << endl
+       << endl
+       << "options:" << endl
+       << "  -c mode,blocks[,block_size[,threshold]]" << endl
+       << "        put an SSD cache of <blocks> blocks in front of the HDD." << endl
+       << "        mode is one of wt (write-through), wb (write-back) or" << endl
+       << "        wa (write-around). Blocks are promoted after <threshold>" << endl
+       << "        accesses (default: 4096-byte blocks, threshold 2)." << endl
+       << "  -s file" << endl
+       << "        use the measured seek profile in <file> (lines of" << endl
+       << "        '<distance> <seek time>')." << endl
+       << "  -S boundary,a,b,c,e" << endl
+       << "        use a piecewise seek curve: a + b*sqrt(d) for seeks over" << endl
+       << "        d < boundary tracks, c + e*d for longer seeks." << endl
+       << "  -z file" << endl
+       << "        use the zone table in <file> (lines of '<first track>" << endl
+       << "        <last track> <sectors per track>') instead of the tracks/" << endl
+       << "        surface and innermost/outermost sector counts from stdin." << endl
+       << "  -a actuators[,interface]" << endl
+       << "        split the surfaces and LBA range between <actuators>" << endl
+       << "        independent actuators sharing a host interface of" << endl
+       << "        <interface> MB/s (default: unlimited)." << endl
+       << "  -k head_switch[,track_skew[,cylinder_skew]]" << endl
+       << "        model head switches and track/cylinder skew (in sectors," << endl
+       << "        0 or omitted: smallest skew hiding the switch)." << endl
+       << "  -m model" << endl
+       << "        simulate the drive model <model> with compile-time geometry" << endl
+       << "        instead of the HDD described on stdin (whose parameters are" << endl
+       << "        still read but ignored). Available models:";
+  for (const DriveModel *m = models; m->name != NULL; m++)
+    cout << " " << m->name;
+  cout << endl
+       << "  -p" << endl
+       << "        parse, simulate and print on separate threads (ignored in" << endl
+       << "        verbose mode)." << endl
+       << "  -r members[,stripe_size[,parallel]]" << endl
+       << "        stripe the address space over <members> identical HDDs in" << endl
+       << "        units of <stripe_size> bytes (default: 65536). With" << endl
+       << "        parallel=1, the members are simulated on separate threads." << endl
+       << "  -d devices[,workers]" << endl
+       << "        simulate <devices> identical HDDs on <workers> threads" << endl
+       << "        (default: one per core). Trace records carry a device ID" << endl
+       << "        after the timestamp: '<time> <device> <r|w> <address>" << endl
+       << "        <length>'." << endl
+       << "  -C prefix,interval" << endl
+       << "        write the simulator state to <prefix>.0, <prefix>.1, ..." << endl
+       << "        every <interval> seconds of simulated time." << endl
+       << "  -R file" << endl
+       << "        resume the replay from the checkpoint <file>, which must" << endl
+       << "        have been taken with the same options and input. -C and" << endl
+       << "        -R need the input on a file, not a pipe." << endl
+       << "  -t file" << endl
+       << "        read the input from <file> instead of stdin." << endl
+       << "  -w start,end[,warmup]" << endl
+       << "        replay only the requests in [<start>, <end>) seconds. The" << endl
+       << "        requests of the <warmup> seconds before the window update" << endl
+       << "        the device but are not printed or counted in the" << endl
+       << "        statistics. The replay seeks to the window with a time" << endl
+       << "        index of the trace in <file>.idx (see -t), which is built" << endl
+       << "        on first use." << endl
+       << "  -M file[,offset[,shift]]" << endl
+       << "        replay the requests of trace <file> ('<time> <r|w>" << endl
+       << "        <address> <length>') instead of those on the input. With" << endl
+       << "        several -M options, the traces are merged in time order" << endl
+       << "        and the latencies are reported per trace. <offset> bytes" << endl
+       << "        are added to the addresses and <shift> seconds to the" << endl
+       << "        timestamps of the trace." << endl
+       << "  -o window" << endl
+       << "        sort requests that are slightly out of timestamp order" << endl
+       << "        with a buffer of <window> requests. Requests displaced" << endl
+       << "        by more than the window are replayed late and counted." << endl
+       << "  -g requests,rate[,reads[,size[,span]]]" << endl
+       << "        replay <requests> synthetic requests of <size> bytes" << endl
+       << "        (default: 4096) arriving at <rate> requests/second at" << endl
+       << "        random addresses in the first <span> bytes (default: the" << endl
+       << "        capacity of the device) instead of those on the input." << endl
+       << "        A fraction of <reads> (default: 0.5) are reads." << endl
+       << "  -l clients[,think]" << endl
+       << "        closed loop: replay the requests with 1, 2, 4, ... <clients>" << endl
+       << "        clients that issue their next request <think> seconds" << endl
+       << "        (default: 0) after the previous one completes, and report" << endl
+       << "        the throughput and the saturation knee." << endl
+       << "  -L min,max[,points[,threads]]" << endl
+       << "        load sweep: replay the requests with their interarrival" << endl
+       << "        times compressed by <points> (default: 8) factors from" << endl
+       << "        <min> to <max> on <threads> threads (default: one per" << endl
+       << "        core) and report latency vs. offered load." << endl
+       << "  -A rate[,model]" << endl
+       << "        estimate the latency of the requests at <rate> requests/" << endl
+       << "        second (0: the rate of the trace) analytically instead of" << endl
+       << "        replaying them. <model> is gg1 (default, interarrival" << endl
+       << "        variability of the trace) or mg1 (Poisson arrivals)." << endl
+       << "  -V" << endl
+       << "        compare the analytic estimate (-A) with a full simulation." << endl
+       << "  -H rate" << endl
+       << "        replay only the requests to a pseudo-random fraction <rate>" << endl
+       << "        of the blocks (of the cache block size, see -c) and scale" << endl
+       << "        the cache and the time since the first request by <rate>." << endl
+       << "  -E min,max[,points[,threads]]" << endl
+       << "        sampling report: replay the requests in full and sampled" << endl
+       << "        (see -H) at <points> (default: 3) rates from <min> to <max>" << endl
+       << "        on <threads> threads (default: one per core) and report the" << endl
+       << "        smallest rate whose results match the full replay." << endl
+       << "  -Q block_size[,rate]" << endl
+       << "        instead of replaying the requests, compute the hit ratio of" << endl
+       << "        an LRU cache of <block_size>-byte blocks for all cache sizes" << endl
+       << "        in one pass, tracking a fraction <rate> (default: 1) of the" << endl
+       << "        blocks." << endl
+       << "  -q accuracy" << endl
+       << "        keep latency distributions in sketches of relative" << endl
+       << "        <accuracy> (e.g., 0.01) instead of keeping every latency." << endl
+       << "  -j file" << endl
+       << "        write a sketch of the latencies and the hot blocks of the" << endl
+       << "        replay to <file>. A resumed replay (-R) cannot be sketched:" << endl
+       << "        checkpoints do not include the sketch." << endl
+       << "  -J file" << endl
+       << "        merge the sketches in the <file>s of -J options (e.g., of" << endl
+       << "        several runs) and print the result. Nothing is simulated." << endl
+       << "  -T interval,file[,format]" << endl
+       << "        write the IOPS, MB/s, mean and p99 latency, queue depth and" << endl
+       << "        utilization of every <interval> seconds of simulated time" << endl
+       << "        to <file>. <format> is csv (default) or bin. A resumed" << endl
+       << "        replay (-R) cannot write a time series: checkpoints do not" << endl
+       << "        include the interval in progress." << endl
+       << endl;
+}
+
+int main(int argc, char *argv[])
 {
   uint32 surfaces, tracks_per_surface, sectors_innermost, sectors_outermost,
          rpm, bytes_per_sector;
   double seek_overhead, seek_per_track;
   bool   verbose;
 
-  HDD *hdd;
-  double t;
-  char rw;
-  uint64 address, length;
+  HDD *hdd = NULL;
+  Disk *disk;
+  HybridDisk *hybrid = NULL;
+  MultiActuatorHDD *multi = NULL;
+  RAID0 *raid = NULL;
+
+  bool   cache = false;
+  char   cache_mode[8];
+  unsigned long long cache_blocks = 0;
+  uint32 cache_block_size = 4096, cache_threshold = 2;
+
+  const char *seek_file = NULL;
+  bool   seek_curve = false;
+  uint32 seek_boundary = 0;
+  double seek_coeff[4];
+
+  const char *zone_file = NULL;
+  vector<HDD_Zone> zones;
+
+  const DriveModel *model = NULL;
+
+  bool   multi_actuator = false;
+  uint32 actuators = 1;
+  double interface_bandwidth = 0.0;
+
+  bool   skew = false;
+  double head_switch = 0.0;
+  uint32 track_skew = 0, cylinder_skew = 0;
+
+  bool   pipeline = false;
+
+  char   checkpoint_prefix[256];
+  const char *checkpoint = NULL, *restore = NULL;
+  double checkpoint_interval = 0.0;
+
+  const char *trace_file = NULL;
+  ifstream trace;
+  bool   window = false;
+  double window_start = 0.0, window_end = 0.0, warmup = 0.0;
+
+  TraceMerge merge;
+  bool   merged = false;
+
+  uint32 reorder_window = 0;
+
+  bool   generate = false;
+  unsigned long long synthetic_requests = 0, synthetic_size = 4096, synthetic_span = 0;
+  double synthetic_rate = 0.0, synthetic_reads = 0.5;
+  uint64 capacity = 0;
+
+  uint32 clients = 0;
+  double think = 0.0;
+
+  bool   analytic = false, validate = false, poisson = false;
+  double analytic_rate = 0.0;
+
+  bool   sweep = false;
+  double sweep_min = 0.0, sweep_max = 0.0;
+  uint32 sweep_points = 8, sweep_threads = 0;
+
+  double sample_rate = 0.0;
+
+  bool   report = false;
+  double report_min = 0.0, report_max = 0.0;
+  uint32 report_points = 3, report_threads = 0;
+
+  uint32 mrc_block_size = 0;
+  double mrc_rate = 1.0;
+
+  double sketch_accuracy = 0.0;
+  const char *sketch_file = NULL;
+  vector<const char*> sketch_inputs;
+
+  double series_interval = 0.0;
+  char   series_file[256];
+  bool   series_binary = false;
+
+  uint32 shards = 0, shard_workers = 0;
+
+  uint32 raid_members = 0, raid_parallel = 0;
+  unsigned long long raid_stripe = 65536;
+
+  // all I/O goes through iostreams; unsynchronized streams are faster and
+  // do not serialize the threads of a pipelined replay on the stdio locks
+  ios::sync_with_stdio(false);
+
+  //
+  // parse command line options
+  //
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "-c") == 0) && (i+1 < argc)) {
+      int n = sscanf(argv[++i], "%7[^,],%llu,%u,%u", cache_mode, &cache_blocks,
+                     &cache_block_size, &cache_threshold);
+      if ((n < 2) || (strcmp(cache_mode, "wt") && strcmp(cache_mode, "wb") &&
+                      strcmp(cache_mode, "wa"))) {
+        cout << "Error: invalid cache specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      cache = true;
+    } else if ((strcmp(argv[i], "-s") == 0) && (i+1 < argc)) {
+      seek_file = argv[++i];
+    } else if ((strcmp(argv[i], "-S") == 0) && (i+1 < argc)) {
+      if (sscanf(argv[++i], "%u,%lf,%lf,%lf,%lf", &seek_boundary, &seek_coeff[0],
+                 &seek_coeff[1], &seek_coeff[2], &seek_coeff[3]) != 5) {
+        cout << "Error: invalid seek curve '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      seek_curve = true;
+    } else if ((strcmp(argv[i], "-z") == 0) && (i+1 < argc)) {
+      zone_file = argv[++i];
+    } else if ((strcmp(argv[i], "-a") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u,%lf", &actuators, &interface_bandwidth) < 1) ||
+          (actuators == 0)) {
+        cout << "Error: invalid actuator specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      interface_bandwidth *= 1000000.0;
+      multi_actuator = true;
+    } else if ((strcmp(argv[i], "-m") == 0) && (i+1 < argc)) {
+      for (model = models; (model->name != NULL) && strcmp(model->name, argv[i+1]); model++);
+      if (model->name == NULL) {
+        cout << "Error: unknown drive model '" << argv[i+1] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      i++;
+    } else if ((strcmp(argv[i], "-k") == 0) && (i+1 < argc)) {
+      if (sscanf(argv[++i], "%lf,%u,%u", &head_switch, &track_skew, &cylinder_skew) < 1) {
+        cout << "Error: invalid skew specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      skew = true;
+    } else if (strcmp(argv[i], "-p") == 0) {
+      pipeline = true;
+    } else if ((strcmp(argv[i], "-r") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u,%llu,%u", &raid_members, &raid_stripe, &raid_parallel) < 1) ||
+          (raid_members == 0) || (raid_stripe == 0)) {
+        cout << "Error: invalid RAID-0 specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-C") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%255[^,],%lf", checkpoint_prefix, &checkpoint_interval) != 2) ||
+          !(checkpoint_interval > 0.0)) {
+        cout << "Error: invalid checkpoint specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      checkpoint = checkpoint_prefix;
+    } else if ((strcmp(argv[i], "-R") == 0) && (i+1 < argc)) {
+      restore = argv[++i];
+    } else if ((strcmp(argv[i], "-t") == 0) && (i+1 < argc)) {
+      trace_file = argv[++i];
+    } else if ((strcmp(argv[i], "-M") == 0) && (i+1 < argc)) {
+      char name[256];
+      unsigned long long offset = 0;
+      double shift = 0.0;
+      if (sscanf(argv[++i], "%255[^,],%llu,%lf", name, &offset, &shift) < 1) {
+        cout << "Error: invalid trace specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      if (!merge.add(name, offset, to_simtime(shift)))
+        return EXIT_FAILURE;
+      merged = true;
+    } else if ((strcmp(argv[i], "-o") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u", &reorder_window) != 1) || (reorder_window == 0)) {
+        cout << "Error: invalid reorder window '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-g") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%llu,%lf,%lf,%llu,%llu", &synthetic_requests, &synthetic_rate,
+                  &synthetic_reads, &synthetic_size, &synthetic_span) < 2) ||
+          !(synthetic_rate > 0.0) || (synthetic_size == 0) ||
+          !(synthetic_reads >= 0.0) || (synthetic_reads > 1.0)) {
+        cout << "Error: invalid workload specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      generate = true;
+    } else if ((strcmp(argv[i], "-l") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u,%lf", &clients, &think) < 1) || (clients == 0) ||
+          !(think >= 0.0)) {
+        cout << "Error: invalid closed-loop specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-L") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%lf,%lf,%u,%u", &sweep_min, &sweep_max, &sweep_points,
+                  &sweep_threads) < 2) ||
+          !(sweep_min > 0.0) || !(sweep_max >= sweep_min) || (sweep_points == 0)) {
+        cout << "Error: invalid load sweep '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      sweep = true;
+    } else if ((strcmp(argv[i], "-A") == 0) && (i+1 < argc)) {
+      char model_name[8] = "gg1";
+      if ((sscanf(argv[++i], "%lf,%7s", &analytic_rate, model_name) < 1) ||
+          !(analytic_rate >= 0.0) || (strcmp(model_name, "gg1") && strcmp(model_name, "mg1"))) {
+        cout << "Error: invalid analytic model '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      poisson = strcmp(model_name, "mg1") == 0;
+      analytic = true;
+    } else if (strcmp(argv[i], "-V") == 0) {
+      validate = true;
+    } else if ((strcmp(argv[i], "-H") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%lf", &sample_rate) != 1) ||
+          !(sample_rate > 0.0) || (sample_rate > 1.0)) {
+        cout << "Error: invalid sampling rate '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-E") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%lf,%lf,%u,%u", &report_min, &report_max, &report_points,
+                  &report_threads) < 2) ||
+          !(report_min > 0.0) || !(report_max >= report_min) || (report_max > 1.0) ||
+          (report_points == 0)) {
+        cout << "Error: invalid sampling report '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      report = true;
+    } else if ((strcmp(argv[i], "-q") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%lf", &sketch_accuracy) != 1) ||
+          !(sketch_accuracy > 0.0) || !(sketch_accuracy < 1.0)) {
+        cout << "Error: invalid sketch accuracy '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-j") == 0) && (i+1 < argc)) {
+      sketch_file = argv[++i];
+    } else if ((strcmp(argv[i], "-J") == 0) && (i+1 < argc)) {
+      sketch_inputs.push_back(argv[++i]);
+    } else if ((strcmp(argv[i], "-T") == 0) && (i+1 < argc)) {
+      char format[8] = "csv";
+      if ((sscanf(argv[++i], "%lf,%255[^,],%7s", &series_interval, series_file, format) < 2) ||
+          !(series_interval > 0.0) || (strcmp(format, "csv") && strcmp(format, "bin"))) {
+        cout << "Error: invalid time series '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      series_binary = strcmp(format, "bin") == 0;
+    } else if ((strcmp(argv[i], "-Q") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u,%lf", &mrc_block_size, &mrc_rate) < 1) ||
+          (mrc_block_size == 0) || !(mrc_rate > 0.0) || (mrc_rate > 1.0)) {
+        cout << "Error: invalid miss ratio curve '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if ((strcmp(argv[i], "-w") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%lf,%lf,%lf", &window_start, &window_end, &warmup) < 2) ||
+          !(window_end > window_start) || !(warmup >= 0.0)) {
+        cout << "Error: invalid time window '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      window = true;
+    } else if ((strcmp(argv[i], "-d") == 0) && (i+1 < argc)) {
+      if ((sscanf(argv[++i], "%u,%u", &shards, &shard_workers) < 1) || (shards == 0)) {
+        cout << "Error: invalid device specification '" << argv[i] << "'" << endl;
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  //
+  // merge the sketches of earlier runs
+  //
+  if (!sketch_inputs.empty()) {
+    TraceSketch merged_sketch;
+
+    if (!merged_sketch.load(sketch_inputs[0]))
+      return EXIT_FAILURE;
+    for (uint32 s = 1; s < sketch_inputs.size(); s++) {
+      TraceSketch next;
+      if (!next.load(sketch_inputs[s]) || !merged_sketch.merge(next))
+        return EXIT_FAILURE;
+    }
+    merged_sketch.print_stats(cout);
+
+    if ((sketch_file != NULL) && !merged_sketch.save(sketch_file))
+      return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+  }
+
+  if (trace_file != NULL) {
+    trace.open(trace_file);
+    if (!trace.good()) {
+      cout << "Error: cannot open input file '" << trace_file << "'" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  istream &in = (trace_file != NULL) ? static_cast<istream&>(trace) : cin;
 
   //
   // read HDD parameters
   //
-  cin >> surfaces;
-  cin >> tracks_per_surface;
-  cin >> sectors_innermost;
-  cin >> sectors_outermost;
-  cin >> rpm;
-  cin >> bytes_per_sector;
-  cin >> seek_overhead;
-  cin >> seek_per_track;
-  cin >> verbose;
-
-  if (!cin.good()) {
-    cout << "Error reading HDD parameters from stdin" << endl
+  in >> surfaces;
+  in >> tracks_per_surface;
+  in >> sectors_innermost;
+  in >> sectors_outermost;
+  in >> rpm;
+  in >> bytes_per_sector;
+  in >> seek_overhead;
+  in >> seek_per_track;
+  in >> verbose;
+
+  if (!in.good()) {
+    cout << "Error reading HDD parameters from "
+         << (trace_file != NULL ? trace_file : "stdin") << endl
          << endl;
     return EXIT_FAILURE;
   }
 
+  if (merged && (window || (checkpoint != NULL) || (restore != NULL) || (shards > 0))) {
+    cout << "Error: merged traces (-M) cannot be combined with -d, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((reorder_window > 0) && (window || (checkpoint != NULL) || (restore != NULL) ||
+                               (shards > 0))) {
+    cout << "Error: reordering (-o) cannot be combined with -d, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (generate && (merged || window || (checkpoint != NULL) || (restore != NULL) ||
+                   (shards > 0))) {
+    cout << "Error: synthetic workloads (-g) cannot be combined with -d, -M, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((clients > 0) && (pipeline || window || (checkpoint != NULL) || (restore != NULL) ||
+                        (shards > 0))) {
+    cout << "Error: closed loops (-l) cannot be combined with -d, -p, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (sweep && ((clients > 0) || pipeline || window || (checkpoint != NULL) ||
+                (restore != NULL) || (shards > 0))) {
+    cout << "Error: load sweeps (-L) cannot be combined with -d, -l, -p, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (analytic && ((model != NULL) || multi_actuator || cache || (raid_members > 0) ||
+                   (shards > 0) || sweep || (clients > 0) || pipeline || window ||
+                   (checkpoint != NULL) || (restore != NULL))) {
+    cout << "Error: the analytic model (-A) needs a plain HDD and cannot be combined with" << endl
+         << "       -a, -c, -d, -l, -L, -m, -p, -r, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((sample_rate > 0.0) && (window || (checkpoint != NULL) || (restore != NULL) ||
+                             (shards > 0))) {
+    cout << "Error: sampling (-H) cannot be combined with -d, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (report && ((sample_rate > 0.0) || analytic || sweep || (clients > 0) || pipeline ||
+                 window || (checkpoint != NULL) || (restore != NULL) || (shards > 0))) {
+    cout << "Error: sampling reports (-E) cannot be combined with -A, -d, -H, -l, -L, -p," << endl
+         << "       -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((mrc_block_size > 0) && (report || (sample_rate > 0.0) || analytic || sweep ||
+                              (clients > 0) || pipeline || window || (checkpoint != NULL) ||
+                              (restore != NULL) || (shards > 0))) {
+    cout << "Error: miss ratio curves (-Q) cannot be combined with -A, -d, -E, -H, -l, -L," << endl
+         << "       -p, -w, -C or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((sketch_file != NULL) && (report || (mrc_block_size > 0) || analytic || sweep ||
+                              (clients > 0) || (restore != NULL))) {
+    cout << "Error: sketches (-j) cannot be combined with -A, -E, -l, -L, -Q or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((series_interval > 0.0) && (report || (mrc_block_size > 0) || analytic || sweep ||
+                                 (clients > 0) || (shards > 0) || (restore != NULL))) {
+    cout << "Error: time series (-T) cannot be combined with -A, -d, -E, -l, -L, -Q or -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (validate && !analytic) {
+    cout << "Error: -V needs an analytic model (-A)" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (generate && (synthetic_span == 0) && (model != NULL)) {
+    cout << "Error: synthetic workloads (-g) on drive models (-m) need a span" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (window && ((trace_file == NULL) || (restore != NULL))) {
+    cout << "Error: time windows (-w) need an input file (-t) and cannot be combined with -R" << endl;
+    return EXIT_FAILURE;
+  }
+
+
+  if ((model != NULL) && (multi_actuator || skew || seek_curve ||
+                          (seek_file != NULL) || (zone_file != NULL))) {
+    cout << "Error: drive models (-m) cannot be combined with -a, -k, -s, -S or -z" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((shards > 0) && ((model != NULL) || multi_actuator || cache || pipeline ||
+                       (checkpoint != NULL) || (restore != NULL) || window)) {
+    cout << "Error: multiple devices (-d) cannot be combined with -a, -c, -m, -p, -C, -R or -w" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((raid_members > 0) && ((model != NULL) || multi_actuator || (shards > 0))) {
+    cout << "Error: RAID-0 (-r) cannot be combined with -a, -d or -m" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if ((actuators > 1) && (surfaces % actuators != 0)) {
+    cout << "Error: " << surfaces << " surfaces cannot be split between "
+         << actuators << " actuators" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (model != NULL) {
+    disk = model->create(verbose);
+  } else {
+    if ((zone_file != NULL) && !HDD::load_zones(zone_file, zones))
+      return EXIT_FAILURE;
+
+    //
+    // create new instance of HDD (one per actuator, device or RAID member).
+    // All devices and members are identical; only the first one is described.
+    //
+    vector<HDD*> heads;
+    uint32 drives = shards > 0 ? shards : (raid_members > 0 ? raid_members : actuators);
+    streambuf *console = cout.rdbuf();
+
+    for (uint32 a = 0; a < drives; a++) {
+      if (!multi_actuator && (a == 1)) cout.rdbuf(NULL);
+
+      if (zone_file != NULL) {
+        tracks_per_surface = zones.back().last_track + 1;
+        hdd = new HDD(
+            surfaces / actuators, zones,
+            rpm, bytes_per_sector,
+            seek_overhead, seek_per_track,
+            verbose);
+      } else {
+        hdd = new HDD(
+            surfaces / actuators, tracks_per_surface,
+            sectors_innermost, sectors_outermost,
+            rpm, bytes_per_sector,
+            seek_overhead, seek_per_track,
+            verbose);
+      }
+      heads.push_back(hdd);
+
+      if (seek_curve)
+        hdd->set_seek_curve(seek_boundary, seek_coeff[0], seek_coeff[1],
+                            seek_coeff[2], seek_coeff[3]);
+
+      if ((seek_file != NULL) && !hdd->load_seek_table(seek_file)) {
+        cout.rdbuf(console);
+        for (uint32 h = 0; h < heads.size(); h++) delete heads[h];
+        return EXIT_FAILURE;
+      }
+
+      if (skew)
+        hdd->set_skew(head_switch, track_skew, cylinder_skew);
+    }
+    cout.rdbuf(console);
+
+    hdd = heads[0];
+    disk = hdd;
+    capacity = hdd->capacity() * (multi_actuator ? actuators : 1) *
+               (raid_members > 0 ? raid_members : 1);
+
+    if (multi_actuator) {
+      multi = new MultiActuatorHDD(heads, interface_bandwidth, verbose);
+      disk = multi;
+    }
+
+    if (raid_members > 0) {
+      raid = new RAID0(vector<Disk*>(heads.begin(), heads.end()), raid_stripe,
+                       raid_parallel != 0, verbose);
+      disk = raid;
+    }
+
+    //
+    // standard tests (on the first actuator)
+    //
+    standard_tests(hdd, tracks_per_surface);
+
+    //
+    // replay a trace of many devices on worker threads
+    //
+    if (shards > 0) {
+      vector<Disk*> devices(heads.begin(), heads.end());
+      ShardedReplay sharded(devices, shard_workers);
+      TraceSketch sketch(sketch_accuracy > 0.0 ? sketch_accuracy : 0.01, cache_block_size);
+
+      if (sketch_file != NULL) sharded.set_sketch(&sketch);
+      sharded.set_accuracy(sketch_accuracy);
+      sharded.run(in, cout);
+      sharded.print_stats(cout);
+
+      if (sketch_file != NULL) {
+        sketch.print_stats(cout);
+        if (!sketch.save(sketch_file)) {
+          for (uint32 h = 0; h < heads.size(); h++) delete heads[h];
+          return EXIT_FAILURE;
+        }
+      }
+
+      for (uint32 h = 0; h < heads.size(); h++) delete heads[h];
+
+      return EXIT_SUCCESS;
+    }
+  }
 
   //
-  // create new instance of HDD
+  // put an SSD cache in front of the HDD
   //
-  hdd = new HDD(
-      surfaces, tracks_per_surface,
-      sectors_innermost, sectors_outermost,
-      rpm, bytes_per_sector,
-      seek_overhead, seek_per_track,
-      verbose);
+  if (cache) {
+    CacheMode mode = WRITE_THROUGH;
+    if (strcmp(cache_mode, "wb") == 0) mode = WRITE_BACK;
+    if (strcmp(cache_mode, "wa") == 0) mode = WRITE_AROUND;
+
+    hybrid = new HybridDisk(
+        new SSD(SSD_READ_LATENCY, SSD_WRITE_LATENCY, SSD_BANDWIDTH, verbose),
+        disk, mode, cache_blocks, cache_block_size, cache_threshold, verbose);
+    disk = hybrid;
+  }
+  disk->set_accuracy(sketch_accuracy);
 
   //
-  // standard tests
+  // process requests from input file. Plain drives are replayed by an engine
+  // specialized for their type; composed devices use the Disk interface.
   //
-  cout.precision(6);
-  t = hdd->seek_time(0, tracks_per_surface/2);
-  cout << "avg. seek time:    " << dec << fixed << t << endl;
+  TraceReader reader(in);
+  TraceSource *source = merged ? static_cast<TraceSource*>(&merge) : NULL;
+  SyntheticTrace *synthetic = NULL;
+  ReorderBuffer *reorder = NULL;
+  SpatialSampler *sampler = NULL;
 
-  t = hdd->seek_time(0, 1);
-  cout << "seek 1 track:      " << dec << fixed << t << endl;
+  if (generate) {
+    synthetic = new SyntheticTrace(synthetic_requests, synthetic_rate, synthetic_reads,
+                                   synthetic_size,
+                                   synthetic_span > 0 ? synthetic_span : capacity);
+    source = synthetic;
+  }
 
-  t = hdd->wait_time();
-  cout << "avg. rot. latency: " << dec << fixed << t << endl;
+  if (reorder_window > 0) {
+    reorder = new ReorderBuffer(source != NULL ? source : &reader, reorder_window);
+    source = reorder;
+  }
 
-  t = hdd->read_time(1);
-  cout << "read 1 sector:     " << dec << fixed << t << endl;
+  if (sample_rate > 0.0) {
+    sampler = new SpatialSampler(source != NULL ? source : &reader, sample_rate,
+                                 cache_block_size);
+    source = sampler;
+    disk->scale_capacity(sample_rate);
+  }
 
-  t = hdd->write_time(1);
-  cout << "write 1 sector:    " << dec << fixed << t << endl;
+  TraceSketch sketch(sketch_accuracy > 0.0 ? sketch_accuracy : 0.01, cache_block_size);
+  TimeSeries series(to_simtime(series_interval), series_binary);
+  if ((series_interval > 0.0) && !series.open(series_file)) {
+    delete sampler;
+    delete reorder;
+    delete synthetic;
+    delete disk;
+    return EXIT_FAILURE;
+  }
 
-  cout << endl << endl;
+  ReplayOptions options = { verbose, pipeline, checkpoint, checkpoint_interval, restore,
+                            trace_file, window, window_start, window_end, warmup,
+                            source, sketch_file != NULL ? &sketch : NULL,
+                            series_interval > 0.0 ? &series : NULL, sketch_accuracy };
+  bool replayed = true;
 
+  if (mrc_block_size > 0) {
+    MissRatioCurve mrc(mrc_block_size, mrc_rate);
+    mrc.load(source != NULL ? source : &reader);
+    mrc.print_stats(cout);
+  } else if (clients > 0) {
+    ClosedLoop loop(disk, to_simtime(think));
+    loop.load(source != NULL ? source : &reader);
+    loop.set_accuracy(sketch_accuracy);
+    replayed = loop.sweep(clients, cout);
+  } else if (analytic) {
+    AnalyticModel queue(hdd);
+    queue.load(source != NULL ? source : &reader);
+    queue.set_accuracy(sketch_accuracy);
+    AnalyticEstimate e = queue.estimate(analytic_rate, poisson);
+    queue.print_stats(cout, e, poisson);
+    if (validate) queue.print_validation(cout, e, queue.validate(e));
+  } else if (sweep) {
+    LoadSweep curve(disk, sweep_threads);
+    curve.load(source != NULL ? source : &reader);
+    curve.set_accuracy(sketch_accuracy);
+    replayed = curve.run(sweep_min, sweep_max, sweep_points);
+    if (replayed) curve.print_stats(cout);
+  } else if (report) {
+    SamplingReport sampling(disk, cache_block_size, report_threads);
+    sampling.load(source != NULL ? source : &reader);
+    sampling.set_accuracy(sketch_accuracy);
+    replayed = sampling.run(report_min, report_max, report_points);
+    if (replayed) sampling.print_stats(cout);
+  } else if ((model != NULL) && (hybrid == NULL))
+    replayed = model->replay(disk, in, cout, options);
+  else if ((hybrid == NULL) && (multi == NULL) && (raid == NULL))
+    replayed = replay_trace(hdd, in, cout, options);
+  else
+    replayed = replay_trace(disk, in, cout, options);
 
-  //
-  // process requests from input file
-  //
-  cin >> t >> rw >> address >> length;
-
-  while (cin.good()) {
-    cout.precision(6);
-    switch (rw) {
-      case 'r': cout << "read"; break;
-      case 'w': cout << "write"; break;
-      default : cout << "error in input trace";
-    }
+  if (replayed && (series_interval > 0.0))
+    replayed = series.close();
 
-    cout << "(" << t << ", " << address << ", " << length << ") = ";
-    cout.flush();
+  if (!replayed) {
+    delete sampler;
+    delete reorder;
+    delete synthetic;
+    delete disk;
+    return EXIT_FAILURE;
+  }
+  delete synthetic;
 
-    switch (rw) {
-      case 'r': t = hdd->read(t, address, length); break;
-      case 'w': t = hdd->write(t, address, length); break;
+  if (sketch_file != NULL) {
+    sketch.print_stats(cout);
+    if (!sketch.save(sketch_file)) {
+      delete sampler;
+      delete reorder;
+      delete disk;
+      return EXIT_FAILURE;
     }
-    cout.precision(6);
-    cout << t << endl;
+  }
+
+  if (sampler != NULL) {
+    sampler->print_stats(cout);
+    delete sampler;
+  }
+
+  if (reorder != NULL) {
+    reorder->print_stats(cout);
+    delete reorder;
+  }
+
+  // miss ratio curves, analytic models, load sweeps and sampling reports do
+  // not access the device itself (the latter work on copies)
+  if ((mrc_block_size == 0) && !analytic && !sweep && !report) {
+    if (hybrid != NULL)
+      hybrid->print_stats(cout);
 
-    cin >> t >> rw >> address >> length;
+    if (multi != NULL)
+      multi->print_stats(cout);
+    else if (raid != NULL)
+      raid->print_stats(cout);
+    else if (hdd != NULL)
+      hdd->print_stats(cout);
   }
 
-  delete hdd;
+  delete disk;
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,421 @@
+//------------------------------------------------------------------------------
+/// @brief rotating disks with compile-time geometry
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_FIXEDHDD_H__
+#define __CA_FIXEDHDD_H__
+
+#include <cstdlib>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "checkpoint.h"
+#include "disk.h"
+#include "hdd.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief compile-time geometry of a drive model
+///
+/// FixedGeometry expands the zone table of a drive model @a M into per-zone
+/// tables at compile time. @a M provides the constants surfaces, sector_size,
+/// rpm, seek_overhead, seek_per_track, zones and zone_table[zones][2] (last
+/// track, sectors per track of every zone, innermost zone first).
+///
+template <class M>
+struct FixedGeometry {
+  uint64 first_block[M::zones];     ///< first block of each zone
+  uint32 first_track[M::zones];     ///< first track of each zone
+  uint32 track_blocks[M::zones];    ///< blocks per track on all surfaces
+  uint64 magic[M::zones];           ///< reciprocal of track_blocks (2^64/x)
+  int64  sector_ps[M::zones];       ///< time to pass one sector (ps)
+  int64  rotation_ps;               ///< time of one revolution (ps)
+  int64  seek_overhead_ps;          ///< seek overhead (ps)
+  int64  seek_per_track_ps;         ///< seek time per track (ps)
+  uint64 total_blocks;              ///< number of blocks on the disk
+  uint32 tracks;                    ///< number of tracks per surface
+  uint32 shift;                     ///< log2(sector_size)
+
+  constexpr FixedGeometry(void)
+    : first_block(), first_track(), track_blocks(), magic(), sector_ps(),
+      rotation_ps((int64)(60.0e12 / M::rpm + 0.5)),
+      seek_overhead_ps((int64)(M::seek_overhead * 1.0e12 + 0.5)),
+      seek_per_track_ps((int64)(M::seek_per_track * 1.0e12 + 0.5)),
+      total_blocks(0), tracks(0), shift(0)
+  {
+    for (uint32 z = 0; z < M::zones; z++) {
+      first_track[z]  = z > 0 ? M::zone_table[z-1][0] + 1 : 0;
+      first_block[z]  = total_blocks;
+      track_blocks[z] = M::zone_table[z][1] * M::surfaces;
+      magic[z]        = ~0ULL / track_blocks[z] + 1;
+      sector_ps[z]    = (int64)(60.0e12 / ((double)M::rpm * M::zone_table[z][1]) + 0.5);
+      total_blocks   += (uint64)(M::zone_table[z][0] + 1 - first_track[z]) * track_blocks[z];
+    }
+    tracks = M::zone_table[M::zones-1][0] + 1;
+    while ((1U << shift) < M::sector_size) shift++;
+  };
+};
+
+//------------------------------------------------------------------------------
+/// @brief rotating disks with compile-time geometry
+///
+/// FixedHDD implements the same access model as HDD (linear seeks, average
+/// rotational latency, zoned transfer rates) for a fixed drive model @a M
+/// whose geometry is known at compile time. Divisions by the sector size
+/// and the number of surfaces become shifts and multiplications and the
+/// per-zone tables are constants.
+///
+template <class M>
+class FixedHDD : public Disk {
+  static_assert((M::sector_size & (M::sector_size - 1)) == 0,
+                "sector size must be a power of two");
+  static_assert(M::zones > 0, "drive model needs at least one zone");
+
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    FixedHDD(bool verbose=false);
+
+    /// @brief destructor
+    virtual ~FixedHDD(void) {};
+
+    /// @brief copy of the drive in its current state
+    virtual Disk* clone(void) const { return new FixedHDD<M>(*this); };
+
+    /// @}
+
+
+    /// @name access methods
+    /// @{
+
+    /// @brief read @a size bytes from @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to read
+    /// @param size number of bytes to read
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
+
+    /// @brief write @a size bytes to @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to write
+    /// @param size number of bytes to write
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @brief process a batch of requests in order
+    /// @param batch requests; completion times are stored in batch.done
+    virtual void process(const DiskBatch &batch);
+
+    /// @}
+
+
+    /// @name access latencies
+    /// @{
+
+    /// @brief seek time to move the head from @from_track to @to_track
+    simtime seek_time(uint32 from_track, uint32 to_track) const;
+
+    /// @brief average rotational latency
+    simtime wait_time(void) const;
+
+    /// @brief time to read @sectors sectors
+    simtime read_time(uint64 sectors) { return transfer_time(sectors); };
+
+    /// @brief time to write @sectors sectors
+    simtime write_time(uint64 sectors) { return transfer_time(sectors); };
+
+    /// @}
+
+
+    /// @name geometry
+    /// @{
+
+    /// @brief number of tracks per surface
+    uint32 tracks(void) const { return _geo.tracks; };
+
+    /// @brief capacity of the disk (bytes)
+    uint64 capacity(void) const { return _geo.total_blocks << _geo.shift; };
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the head position to a checkpoint
+    virtual bool save(ostream &os);
+
+    /// @brief restore the state written by save()
+    virtual bool load(istream &is);
+
+    /// @}
+
+
+  protected:
+    static constexpr FixedGeometry<M> _geo = FixedGeometry<M>(); ///< geometry
+    bool   _verbose;                ///< toggle verbose output
+    uint32 _head_pos;               ///< current position (track) of r/w heads.
+    HDD_Position _target_pos;       ///< block position of desired address
+
+
+    /// @brief translate a byte address into a position on the HDD
+    /// @param address byte address
+    /// @param pos (output) pointer to result
+    /// @retval true if translation was successful, false otherwise
+    bool   decode(uint64 address, HDD_Position *pos) const;
+
+    /// @brief zone containing @a block
+    uint32 block_zone(uint64 block) const;
+
+    /// @brief zone containing @a track
+    uint32 track_zone(uint32 track) const;
+
+    /// @brief time to transfer @a sectors sectors starting at _target_pos
+    simtime transfer_time(uint64 sectors);
+
+    /// @brief serve a read or write request
+    simtime access(simtime ts, uint64 address, uint64 size);
+};
+
+template <class M>
+constexpr FixedGeometry<M> FixedHDD<M>::_geo;
+
+
+//------------------------------------------------------------------------------
+// FixedHDD
+//
+template <class M>
+FixedHDD<M>::FixedHDD(bool verbose)
+  : _verbose(verbose)
+{
+  _head_pos = 0; // head starts at track 0
+  _target_pos.surface = _target_pos.track = _target_pos.sector = 0;
+  _target_pos.max_access = 0;
+
+  //
+  // print info
+  //
+  cout.precision(3);
+  cout << "HDD (" << M::name() << "): " << endl
+       << "  surfaces:                  " << M::surfaces << endl
+       << "  tracks/surface:            " << _geo.tracks << endl
+       << "  zones:                     " << M::zones << endl
+       << "  sect on innermost track:   " << M::zone_table[0][1] << endl
+       << "  sect on outermost track:   " << M::zone_table[M::zones-1][1] << endl
+       << "  rpm:                       " << M::rpm << endl
+       << "  sector size:               " << M::sector_size << endl
+       << "  number of sectors total:   " << _geo.total_blocks << endl
+       << "  capacity (GB):             " << capacity()/1000000000.0 << endl
+       << endl;
+}
+
+template <class M>
+simtime FixedHDD<M>::read(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "FixedHDD::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size);
+}
+
+template <class M>
+simtime FixedHDD<M>::write(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "FixedHDD::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size);
+}
+
+template <class M>
+void FixedHDD<M>::process(const DiskBatch &batch)
+{
+  if (_verbose) {
+    Disk::process(batch);
+    return;
+  }
+
+  for (uint64 i = 0; i < batch.count; i++) {
+    char op = batch.op[i];
+    batch.done[i] = ((op == 'r') || (op == 'w'))
+                    ? access(batch.ts[i], batch.address[i], batch.size[i])
+                    : batch.ts[i];
+  }
+}
+
+template <class M>
+bool FixedHDD<M>::save(ostream &os)
+{
+  ckpt_put_tag(os, "FHDD");
+  ckpt_put(os, _geo.total_blocks);
+  ckpt_put(os, _head_pos);
+  ckpt_put(os, _target_pos.surface);
+  ckpt_put(os, _target_pos.track);
+  ckpt_put(os, _target_pos.sector);
+  ckpt_put(os, _target_pos.max_access);
+
+  return os.good();
+}
+
+template <class M>
+bool FixedHDD<M>::load(istream &is)
+{
+  if (!ckpt_get_tag(is, "FHDD") || !ckpt_check(is, _geo.total_blocks, "drive model"))
+    return false;
+
+  if (!ckpt_get(is, _head_pos) ||
+      !ckpt_get(is, _target_pos.surface) ||
+      !ckpt_get(is, _target_pos.track) ||
+      !ckpt_get(is, _target_pos.sector) ||
+      !ckpt_get(is, _target_pos.max_access)) {
+    cout << "Error: corrupt HDD state in checkpoint" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+template <class M>
+simtime FixedHDD<M>::access(simtime ts, uint64 address, uint64 size)
+{
+  uint32 sectors = size >> _geo.shift;
+
+  if (decode(address, &_target_pos))
+    ts += seek_time(_head_pos, _target_pos.track) + wait_time() + transfer_time(sectors);
+
+  return ts;
+}
+
+template <class M>
+simtime FixedHDD<M>::seek_time(uint32 from_track, uint32 to_track) const
+{
+  if (from_track == to_track)
+    return 0;
+
+  int64 distance = to_track > from_track ? to_track - from_track : from_track - to_track;
+  return ps_to_simtime(_geo.seek_overhead_ps + distance * _geo.seek_per_track_ps);
+}
+
+template <class M>
+simtime FixedHDD<M>::wait_time(void) const
+{
+  // average rotational latency = (1/2) * (1/RPM) * (60sec/1min)
+  return ps_to_simtime(_geo.rotation_ps / 2);
+}
+
+template <class M>
+uint32 FixedHDD<M>::block_zone(uint64 block) const
+{
+  // the zone count is a compile-time constant; this loop unrolls into a
+  // short sequence of compares
+  uint32 z = 0;
+  for (uint32 i = 1; i < M::zones; i++)
+    z += (block >= _geo.first_block[i]);
+
+  return z;
+}
+
+template <class M>
+uint32 FixedHDD<M>::track_zone(uint32 track) const
+{
+  uint32 z = 0;
+  for (uint32 i = 1; i < M::zones; i++)
+    z += (track >= _geo.first_track[i]);
+
+  return z;
+}
+
+template <class M>
+bool FixedHDD<M>::decode(uint64 address, HDD_Position *pos) const
+{
+  // check address validity: 0 <= address < capacity
+  if (address >= capacity())
+    return false;
+
+  uint64 block  = address >> _geo.shift;
+  uint32 z      = block_zone(block);
+  uint64 offset = block - _geo.first_block[z];
+  uint64 tb     = _geo.track_blocks[z];
+
+  // offset / track_blocks by multiplication with the reciprocal
+#ifdef __SIZEOF_INT128__
+  uint64 track = (uint64)(((unsigned __int128)offset * _geo.magic[z]) >> 64);
+#else
+  uint64 track = offset / tb;
+#endif
+  offset -= track * tb;
+  if (offset >= tb) { track++; offset -= tb; }
+
+  // blocks are laid out sector by sector across all surfaces of a track
+  pos->track   = _geo.first_track[z] + (uint32)track;
+  pos->sector  = (uint32)(offset / M::surfaces);
+  pos->surface = (uint32)(offset % M::surfaces);
+  pos->max_access = (uint32)(tb - offset);
+
+  return true;
+}
+
+template <class M>
+simtime FixedHDD<M>::transfer_time(uint64 sectors)
+{
+  int64  time = 0;  // picoseconds, rounded to simulated time once at the end
+  uint32 track = _target_pos.track;
+  uint64 offset = (uint64)_target_pos.sector * M::surfaces + _target_pos.surface;
+
+  while (1)
+  {
+    uint32 z = track_zone(track);
+    uint64 left = _geo.track_blocks[z] - offset;
+    uint64 n = sectors < left ? sectors : left;
+
+    time += n * _geo.sector_ps[z];
+    sectors -= n;
+
+    if (sectors == 0)
+      break;
+
+    track++;
+    offset = 0;
+
+    // add wait_time everytime head changes track
+    time += (seek_time(track, track+1) + wait_time()) * PS_PER_NS;
+  }
+
+  _head_pos = track;
+  return ps_to_simtime(time);
+}
+
+
+#endif // __CA_FIXEDHDD_H__
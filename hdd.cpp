@@ -37,8 +37,10 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 
 #include "hdd.h"
+#include "checkpoint.h"
 using namespace std;
 
 //------------------------------------------------------------------------------
@@ -49,9 +51,9 @@ HDD::HDD(uint32 surfaces, uint32 tracks_per_surface,
          uint32 rpm, uint32 sector_size,
          double seek_overhead, double seek_per_track,
          bool verbose)
-  : _surfaces(surfaces), _rpm(rpm), _sector_size(sector_size),
-    _seek_overhead(seek_overhead), _seek_per_track(seek_per_track),
-    _verbose(verbose), _sectors_innermost_track(sectors_innermost_track)
+  : _surfaces(surfaces), _tracks(tracks_per_surface), _verbose(verbose), _rpm(rpm),
+    _sector_size(sector_size), _seek_overhead(seek_overhead),
+    _seek_per_track(seek_per_track)
 {
 
   /* check validity */
@@ -59,20 +61,26 @@ HDD::HDD(uint32 surfaces, uint32 tracks_per_surface,
     cout << "Error: outermost track should contain more sectors than innermost" << endl;
 
 
-  _sectors_diff = (double)(sectors_outermost_track - sectors_innermost_track) 
-                  / (tracks_per_surface - 1);
- 
-  /* calculate total sector # */
-  uint32 total_sector = 0;
-  double track_sector = (double)_sectors_innermost_track;
+  double sectors_diff = (double)(sectors_outermost_track - sectors_innermost_track)
+                        / (tracks_per_surface - 1);
 
-  for (int i = 0; i < tracks_per_surface; i++)
-    total_sector += (uint32)floor(track_sector + (_sectors_diff * i));
-  
-  total_sector *= _surfaces;
+  /* build zone table: merge consecutive tracks with the same sector count */
+  HDD_Zone z;
+  for (uint32 i = 0; i < tracks_per_surface; i++) {
+    uint32 track_sector = (uint32)floor((double)sectors_innermost_track + (sectors_diff * i));
+
+    if (!_zones.empty() && (_zones.back().sectors == track_sector)) {
+      _zones.back().last_track = i;
+    } else {
+      z.first_track = z.last_track = i;
+      z.sectors = track_sector;
+      _zones.push_back(z);
+    }
+  }
+
+  setup_zones();
+  init();
 
-  _capacity = (total_sector/1000000000.0) * sector_size;
-  _head_pos = 0; // head starts at track 0
   //
   // print info
   //
@@ -84,20 +92,163 @@ HDD::HDD(uint32 surfaces, uint32 tracks_per_surface,
        << "  sect on outermost track:   " << sectors_outermost_track << endl
        << "  rpm:                       " << rpm << endl
        << "  sector size:               " << _sector_size << endl
-       << "  number of sectors total:   " << total_sector << endl
+       << "  number of sectors total:   " << _total_sectors << endl
+       << "  capacity (GB):             " << _capacity << endl
+       << endl;
+}
+
+HDD::HDD(uint32 surfaces, const vector<HDD_Zone> &zones,
+         uint32 rpm, uint32 sector_size,
+         double seek_overhead, double seek_per_track,
+         bool verbose)
+  : _surfaces(surfaces), _tracks(0), _verbose(verbose), _rpm(rpm),
+    _sector_size(sector_size), _seek_overhead(seek_overhead),
+    _seek_per_track(seek_per_track), _zones(zones)
+{
+  if (!setup_zones())
+    cout << "Error: zone table must cover contiguous tracks starting at track 0" << endl;
+
+  init();
+
+  //
+  // print info
+  //
+  cout.precision(3);
+  cout << "HDD: " << endl
+       << "  surfaces:                  " << _surfaces << endl
+       << "  tracks/surface:            " << _tracks << endl
+       << "  zones:                     " << _zones.size() << endl
+       << "  sect on innermost track:   " << track_sectors(0) << endl
+       << "  sect on outermost track:   " << track_sectors(_tracks > 0 ? _tracks-1 : 0) << endl
+       << "  rpm:                       " << rpm << endl
+       << "  sector size:               " << _sector_size << endl
+       << "  number of sectors total:   " << _total_sectors << endl
        << "  capacity (GB):             " << _capacity << endl
        << endl;
 }
 
+void HDD::init(void)
+{
+  _head_pos = 0; // head starts at track 0
+  _target_pos.surface = _target_pos.track = _target_pos.sector = 0;
+  _target_pos.max_access = 0;
+  _target_block = 0;
+  _target_zone = 0;
+  _cursor.valid = false;
+  _cursor.block = _cursor.offset = 0;
+  _cursor.track = _cursor.zone = 0;
+  _decodes = _sequential_decodes = 0;
+  _skew = false;
+  _head_switch = 0;
+  _track_skew = _cylinder_skew = 0;
+
+  // linear seek model: seek_overhead + distance*seek_per_track
+  int64 overhead_ps  = (int64)(_seek_overhead * 1.0e12 + 0.5);
+  int64 per_track_ps = (int64)(_seek_per_track * 1.0e12 + 0.5);
+
+  _seek_table.assign(_tracks > 1 ? _tracks : 2, 0);
+  for (uint32 d = 1; d < _seek_table.size(); d++)
+    _seek_table[d] = ps_to_simtime(overhead_ps + d * per_track_ps);
+}
+
+bool HDD::setup_zones(void)
+{
+  bool valid = !_zones.empty();
+  uint64 block = 0;
+
+  if (_zones.empty()) {
+    // keep the HDD usable: a single zone with one track
+    HDD_Zone z;
+    z.first_track = z.last_track = 0;
+    z.sectors = 1;
+    _zones.push_back(z);
+  }
+
+  for (uint32 i = 0; i < _zones.size(); i++) {
+    uint32 expected = i > 0 ? _zones[i-1].last_track + 1 : 0;
+
+    if ((_zones[i].first_track != expected) ||
+        (_zones[i].last_track < _zones[i].first_track) ||
+        (_zones[i].sectors == 0))
+      valid = false;
+
+    _zones[i].first_block = block;
+    _zones[i].sector_ps = (int64)(60.0e12 / ((double)_rpm * _zones[i].sectors) + 0.5);
+    block += (uint64)(_zones[i].last_track - _zones[i].first_track + 1)
+             * _zones[i].sectors * _surfaces;
+  }
+
+  _tracks = _zones.back().last_track + 1;
+  _total_sectors = block;
+  _rotation_ps = (int64)(60.0e12 / _rpm + 0.5);
+
+  // struct-of-arrays copy of the zone table for the batch kernels. Padding
+  // zones start beyond any block so that a binary search never selects them.
+  uint32 padded = 1;
+  while (padded < _zones.size()) padded <<= 1;
+
+  _zone_first_block.assign(padded, numeric_limits<int64>::max());
+  _zone_first_track.assign(padded, 0);
+  _zone_track_blocks.assign(padded, 1);
+  _cursor_window = numeric_limits<uint64>::max();
+  for (uint32 i = 0; i < _zones.size(); i++) {
+    _zone_first_block[i]  = _zones[i].first_block;
+    _zone_first_track[i]  = _zones[i].first_track;
+    _zone_track_blocks[i] = (int64)_zones[i].sectors * _surfaces;
+    _cursor_window = min(_cursor_window, (uint64)_zone_track_blocks[i] * HDD_CURSOR_TRACKS);
+  }
+  _capacity = (_total_sectors/1000000000.0) * _sector_size;
+
+  return valid;
+}
+
+bool HDD::load_zones(const char *filename, vector<HDD_Zone> &zones)
+{
+  ifstream in(filename);
+  HDD_Zone z;
+
+  if (!in.is_open()) {
+    cout << "Error: cannot open zone table '" << filename << "'" << endl;
+    return false;
+  }
+
+  zones.clear();
+  while (in >> z.first_track >> z.last_track >> z.sectors) {
+    z.first_block = 0;
+    zones.push_back(z);
+  }
+
+  if (!in.eof() || zones.empty()) {
+    cout << "Error: malformed zone table '" << filename << "'" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+const HDD_Zone& HDD::zone(uint32 track) const
+{
+  // binary search for the last zone starting at or before track
+  uint32 lo = 0, hi = _zones.size();
+
+  while (hi - lo > 1) {
+    uint32 mid = (lo + hi) / 2;
+    if (_zones[mid].first_track <= track) lo = mid;
+    else hi = mid;
+  }
+
+  return _zones[lo];
+}
+
 HDD::~HDD(void)
 {
   // TODO
 }
 
-double HDD::read(double ts, uint64 address, uint64 size)
+simtime HDD::read(simtime ts, uint64 address, uint64 size)
 {
   if (_verbose)
-    cout << "HDD::read(" << ts << ", " << hex << address << ", " << hex << size << ")" << endl;
+    cout << "HDD::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << endl;
   // FIXME
   // what if size goes beyond disk size?
   uint32 sectors = size / _sector_size;
@@ -110,172 +261,364 @@ double HDD::read(double ts, uint64 address, uint64 size)
   return ts;
 }
 
-double HDD::write(double ts, uint64 address, uint64 size)
+simtime HDD::write(simtime ts, uint64 address, uint64 size)
 {
   // TODO
   if (_verbose)
-    cout << "HDD::write(" << ts << ", " << hex << address << ", " << hex << size << ")" << endl;
+    cout << "HDD::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << endl;
   // FIXME
   // what if size goes beyond disk size?
   uint32 sectors = size / _sector_size;
 
   if (decode(address, &_target_pos))
   {
-    ts += seek_time(_head_pos, _target_pos.track) + wait_time() + read_time(sectors);
+    ts += seek_time(_head_pos, _target_pos.track) + wait_time() + write_time(sectors);
   }
 
   return ts;
 }
 
-double HDD::seek_time(uint32 from_track, uint32 to_track)
+void HDD::process(const DiskBatch &batch)
 {
-  if (from_track == to_track)
-    return 0.0;
+  // verbose output is per access; keep it in program order
+  if (_verbose) {
+    Disk::process(batch);
+    return;
+  }
 
-  return abs((double)to_track - (double)from_track) * _seek_per_track + _seek_overhead;
+  if (_batch_track.size() < batch.count) {
+    _batch_track.resize(batch.count);
+    _batch_surface.resize(batch.count);
+    _batch_sector.resize(batch.count);
+    _batch_valid.resize(batch.count);
+    _batch_sequential.resize(batch.count);
+    _batch_address.resize(batch.count);
+  }
+
+  // pass 1: translate the addresses of all requests that do not continue
+  // the previous one. Sequential requests are translated incrementally from
+  // the end of their predecessor in pass 2.
+  uint64 end = _cursor.valid ? _cursor.block * _sector_size : numeric_limits<uint64>::max();
+  uint64 window = _cursor_window * _sector_size;
+  uint64 n = 0;
+
+  for (uint64 i = 0; i < batch.count; i++) {
+    char op = batch.op[i];
+    if ((op != 'r') && (op != 'w'))
+      continue;
+
+    uint64 address = batch.address[i];
+    _batch_sequential[i] = (address >= end) && (address - end < window);
+    if (!_batch_sequential[i])
+      _batch_address[n++] = address;
+    end = address + batch.size[i];
+  }
+
+  decode_batch(&_batch_address[0], n,
+               &_batch_track[0], &_batch_surface[0], &_batch_sector[0],
+               &_batch_valid[0]);
+
+  // pass 2: cost the accesses in order (the head position carries over)
+  simtime wait = wait_time();
+  n = 0;
+  for (uint64 i = 0; i < batch.count; i++) {
+    simtime ts = batch.ts[i];
+    char   op = batch.op[i];
+
+    if ((op == 'r') || (op == 'w')) {
+      bool valid;
+
+      if (_batch_sequential[i]) {
+        valid = decode(batch.address[i], &_target_pos);
+      } else {
+        valid = _batch_valid[n];
+        if (valid) {
+          _target_pos.track   = _batch_track[n];
+          _target_pos.surface = _batch_surface[n];
+          _target_pos.sector  = _batch_sector[n];
+          _target_block = batch.address[i] / _sector_size;
+          _target_zone  = &zone(_target_pos.track) - &_zones[0];
+          _decodes++;
+        }
+        n++;
+      }
+
+      if (valid)
+        ts += seek_time(_head_pos, _target_pos.track) + wait
+              + transfer_time((uint32)(batch.size[i] / _sector_size));
+    }
+    batch.done[i] = ts;
+  }
 }
 
-double HDD::wait_time(void)
+simtime HDD::seek_time(uint32 from_track, uint32 to_track)
 {
-  // average rotational latency = (1/2) * (1/RPM) * (60sec/1min)
-  return ((double)1/2) * ((double)1/_rpm) * 60;
+  uint32 distance = from_track > to_track ? from_track - to_track : to_track - from_track;
+
+  if (distance >= _seek_table.size()) distance = _seek_table.size() - 1;
+  return _seek_table[distance];
 }
 
-double HDD::read_time(uint64 sectors)
+void HDD::set_seek_curve(uint32 boundary,
+                         double sqrt_overhead, double sqrt_coeff,
+                         double linear_overhead, double linear_coeff)
 {
-  // TODO
-  double time = 0;
-  uint32 read = 0;
-  uint32 track_sector;
-  uint32 max_access;
+  // precompute the seek time for every possible distance so that evaluating
+  // the curve costs a single table lookup
+  _seek_table.assign(_tracks > 1 ? _tracks : 2, 0);
+
+  for (uint32 d = 1; d < _seek_table.size(); d++) {
+    if (d < boundary)
+      _seek_table[d] = to_simtime(sqrt_overhead + sqrt_coeff * sqrt((double)d));
+    else
+      _seek_table[d] = to_simtime(linear_overhead + linear_coeff * d);
+  }
 
-  HDD_Position curr_pos;
-  curr_pos.surface = _target_pos.surface;
-  curr_pos.track   = _target_pos.track;
-  curr_pos.sector  = _target_pos.sector;
+  cout.precision(6);
+  cout << "HDD seek curve: " << endl
+       << "  sqrt/linear boundary:      " << boundary << endl
+       << "  short seeks:               " << fixed << sqrt_overhead
+       << " + " << sqrt_coeff << "*sqrt(d)" << endl
+       << "  long seeks:                " << fixed << linear_overhead
+       << " + " << linear_coeff << "*d" << endl
+       << endl;
+}
 
-  while (1)
-  {
-    track_sector = (uint32) floor((double)_sectors_innermost_track + (_sectors_diff * curr_pos.track));
-    max_access   = ((track_sector - (curr_pos.sector + 1)) * _surfaces) + (_surfaces - curr_pos.surface);
-    
-    // read until max_access in a single track
-    for (read = 0; sectors > 0 && read < max_access; read++)
-    {
-      time += (1/(double)_rpm) * (1/(double)track_sector) * 60;
-      sectors--;
+bool HDD::load_seek_table(const char *filename)
+{
+  ifstream in(filename);
+  vector<double> distance, time;
+  double d, t;
+
+  if (!in.is_open()) {
+    cout << "Error: cannot open seek table '" << filename << "'" << endl;
+    return false;
+  }
+
+  while (in >> d >> t) {
+    if ((d < 0) || (!distance.empty() && (d <= distance.back()))) {
+      cout << "Error: seek table distances must be increasing" << endl;
+      return false;
     }
-    
-    if (sectors <= 0)
-      break;
+    distance.push_back(d);
+    time.push_back(t);
+  }
 
-    curr_pos.surface = 0;
-    curr_pos.track ++;
-    curr_pos.sector = 0;
-  
-    // add wait_time everytime head changes track
-    time += seek_time(curr_pos.track, curr_pos.track+1) + wait_time(); 
+  if (!in.eof() || distance.empty()) {
+    cout << "Error: malformed seek table '" << filename << "'" << endl;
+    return false;
   }
-  
-  _head_pos = curr_pos.track;
+
+  // interpolate the measured points into a table covering every distance
+  _seek_table.assign(_tracks > 1 ? _tracks : 2, 0);
+
+  uint32 p = 0;
+  for (uint32 k = 1; k < _seek_table.size(); k++) {
+    while ((p + 2 < distance.size()) && (distance[p+1] < k)) p++;
+
+    double seek = time[0];
+    if (distance.size() > 1) {
+      double slope = (time[p+1] - time[p]) / (distance[p+1] - distance[p]);
+      seek = time[p] + slope * (k - distance[p]);
+    }
+    _seek_table[k] = seek > 0.0 ? to_simtime(seek) : 0;
+  }
+
+  cout << "HDD seek table: " << endl
+       << "  file:                      " << filename << endl
+       << "  measured points:           " << distance.size() << endl
+       << endl;
+
+  return true;
+}
+
+simtime HDD::wait_time(void)
+{
+  // average rotational latency = (1/2) * (1/RPM) * (60sec/1min)
+  return ps_to_simtime(_rotation_ps / 2);
+}
+
+simtime HDD::read_time(uint64 sectors)
+{
+  return transfer_time(sectors);
+}
+
+simtime HDD::write_time(uint64 sectors)
+{
+  return transfer_time(sectors);
+}
+
+void HDD::set_skew(double head_switch, uint32 track_skew, uint32 cylinder_skew)
+{
+  _skew = true;
+  _head_switch = to_simtime(head_switch);
+  _track_skew = track_skew;
+  _cylinder_skew = cylinder_skew;
+
+  cout.precision(6);
+  cout << "HDD skew: " << endl
+       << "  head switch time:          " << fixed << head_switch << endl
+       << "  track skew (sectors):      ";
+  if (_track_skew > 0) cout << _track_skew << endl; else cout << "auto" << endl;
+  cout << "  cylinder skew (sectors):   ";
+  if (_cylinder_skew > 0) cout << _cylinder_skew << endl; else cout << "auto" << endl;
+  cout.precision(3);
+  cout << "  sustained MB/s (inner):    " << fixed << sequential_bandwidth(0)/1000000.0 << endl
+       << "  sustained MB/s (outer):    " << fixed
+       << sequential_bandwidth(_tracks > 0 ? _tracks-1 : 0)/1000000.0 << endl
+       << endl;
+}
+
+double HDD::sequential_bandwidth(uint32 track)
+{
+  HDD_Position saved_pos = _target_pos;
+  uint64 saved_block = _target_block;
+  uint32 saved_zone = _target_zone;
+  HDD_Cursor saved_cursor = _cursor;
+  uint32 saved_head = _head_pos;
+  uint32 track_sector = track_sectors(track);
+
+  // time to stream one full cylinder including the switch to the next one
+  _target_pos.surface = 0;
+  _target_pos.track = track;
+  _target_pos.sector = 0;
+  _target_block = 0;
+  _target_zone = &zone(track) - &_zones[0];
+  double time = to_seconds(transfer_time((uint64)track_sector * _surfaces + 1)
+                           - ps_to_simtime(sector_time(track + 1)));
+
+  _target_pos = saved_pos;
+  _target_block = saved_block;
+  _target_zone = saved_zone;
+  _cursor = saved_cursor;
+  _head_pos = saved_head;
+
+  return time > 0.0 ? (double)track_sector * _surfaces * _sector_size / time : 0.0;
+}
+
+int64 HDD::switch_time(uint32 track, simtime settle, uint32 skew)
+{
+  int64 st = sector_time(track);
+  int64 settle_ps = settle * PS_PER_NS;
+
+  // with skew the first sector of the next track passes under the head just
+  // after the switch has completed. If the skew is too small to cover the
+  // switch, the sector is missed and the head waits for a full revolution.
+  if (skew == 0)
+    skew = (uint32)((settle_ps + st - 1) / st);
+
+  int64 time = skew * st;
+  if (time < settle_ps)
+    time += _rotation_ps;
+
   return time;
 }
 
-double HDD::write_time(uint64 sectors)
+simtime HDD::transfer_time(uint64 sectors)
 {
-  double time = 0;
-  uint32 read = 0;
+  int64  time = 0;  // picoseconds, rounded to simulated time once at the end
   uint32 track_sector;
-  uint32 max_access;
+  uint64 offset, left, n;
+  uint64 end_block = _target_block + sectors;
+  const HDD_Zone *z = &_zones[_target_zone];
+  const HDD_Zone *last_zone = &_zones.back();
 
   HDD_Position curr_pos;
   curr_pos.surface = _target_pos.surface;
   curr_pos.track   = _target_pos.track;
   curr_pos.sector  = _target_pos.sector;
 
+  // every sector costs one sector time, i.e., the sectors of a cylinder are
+  // transferred as _surfaces consecutive tracks of track_sector sectors each.
+  // offset is the position of the current sector within its cylinder.
+  offset = (uint64)curr_pos.sector * _surfaces + curr_pos.surface;
+
   while (1)
   {
-    track_sector = (uint32) floor((double)_sectors_innermost_track + (_sectors_diff * curr_pos.track));
-    max_access   = ((track_sector - (curr_pos.sector + 1)) * _surfaces) + (_surfaces - curr_pos.surface);
-    
-    // read until max_access in a single track
-    for (read = 0; sectors > 0 && read < max_access; read++)
-    {
-      time += (1/(double)_rpm) * (1/(double)track_sector) * 60;
-      sectors--;
-    }
-    
-    if (sectors <= 0)
+    track_sector = z->sectors;
+
+    // without skew modeling, transfer up to the end of the cylinder; otherwise
+    // up to the end of the current track
+    if (_skew)
+      left = (offset / track_sector + 1) * track_sector - offset;
+    else
+      left = (uint64)track_sector * _surfaces - offset;
+
+    n = sectors < left ? sectors : left;
+    time += n * z->sector_ps;
+    sectors -= n;
+    offset += n;
+
+    if (sectors == 0)
       break;
 
-    curr_pos.surface = 0;
+    if (offset < (uint64)track_sector * _surfaces) {
+      // head switch to the next surface within the cylinder
+      time += switch_time(curr_pos.track, _head_switch, _track_skew);
+      continue;
+    }
+
     curr_pos.track ++;
-    curr_pos.sector = 0;
-  
-    // add wait_time everytime head changes track
-    time += seek_time(curr_pos.track, curr_pos.track+1) + wait_time(); 
+    offset = 0;
+    if ((curr_pos.track > z->last_track) && (z < last_zone))
+      z++;
+
+    if (_skew)
+      time += switch_time(curr_pos.track, seek_time(curr_pos.track-1, curr_pos.track),
+                          _cylinder_skew);
+    else
+      // add wait_time everytime head changes track
+      time += (seek_time(curr_pos.track, curr_pos.track+1) + wait_time()) * PS_PER_NS;
   }
-  
+
   _head_pos = curr_pos.track;
-  return time;
+
+  // remember where the access ended for the next sequential request
+  _cursor.valid  = true;
+  _cursor.block  = end_block;
+  _cursor.track  = curr_pos.track;
+  _cursor.zone   = z - &_zones[0];
+  _cursor.offset = offset;
+
+  return ps_to_simtime(time);
+}
+
+uint32 HDD::track(uint64 address) const
+{
+  if (address >= _total_sectors * _sector_size)
+    return _tracks;
+
+  uint64 block = address / _sector_size;
+  uint32 lo = 0, hi = _zones.size();
+  while (hi - lo > 1) {
+    uint32 mid = (lo + hi) / 2;
+    if (_zones[mid].first_block <= block) lo = mid;
+    else hi = mid;
+  }
+  const HDD_Zone &z = _zones[lo];
+
+  return z.first_track + (uint32)((block - z.first_block) / ((uint64)z.sectors * _surfaces));
 }
 
 bool HDD::decode(uint64 address, HDD_Position *pos)
 {
   // check address validity: 0 <= address < capacity
-  if (address < 0 || address > (uint64)(_capacity * 1000000000.0))
+  if (address >= _total_sectors * _sector_size)
     return false;
 
-  uint32 block_index = address / _sector_size;
-  uint32 surface_index = 0;
-  uint32 track_index = 0;
-  uint32 sector_index = 0;
+  uint64 block_index = address / _sector_size;
   uint32 max_access = 0;
-  uint32 total_sector = 0;
   uint32 track_sector = 0; // number of sectors per track (on 1 surface)
-  
-  /* dertermine track index */
-  while (1)
-  {
-    track_sector = (uint32) floor((double)_sectors_innermost_track + (_sectors_diff * track_index));
-    total_sector += track_sector * _surfaces;
-
-    if (total_sector-1 >= block_index)
-      break;
-
-    track_index++;
-  }
-
-  /* determine surface index & sector index */
-  // number of sectors on current track
-  track_sector = (uint32) floor((double)_sectors_innermost_track + (_sectors_diff * track_index)); 
-  // set total_sector to first block index on current track
-  total_sector -= track_sector * _surfaces; 
-  bool end_flag = true;
 
-  while (sector_index < track_sector && total_sector < block_index)
-  {
-    for (surface_index = 0; surface_index < _surfaces; surface_index++)
-    {
-      if (total_sector >= block_index)
-      {
-        end_flag = false;
-        break;
-      }
+  _decodes++;
+  _target_block = block_index;
 
-      total_sector++;
-    }
+  if (decode_sequential(block_index, pos))
+    _sequential_decodes++;
+  else
+    _target_zone = locate(block_index, pos);
 
-    if (end_flag)
-    {
-      surface_index = surface_index % _surfaces;
-      sector_index++;
-    }
-  }
-  
-  pos->surface = surface_index;
-  pos->track = track_index;
-  pos->sector = sector_index;
+  track_sector = _zones[_target_zone].sectors;
   max_access = ((track_sector - (pos->sector + 1)) * _surfaces) + (_surfaces - pos->surface); 
 
   /* print info */
@@ -295,3 +638,124 @@ bool HDD::decode(uint64 address, HDD_Position *pos)
 }
 
 
+
+uint32 HDD::locate(uint64 block, HDD_Position *pos) const
+{
+  /* determine zone: last zone whose first block is at or before block */
+  uint32 lo = 0, hi = _zones.size();
+  while (hi - lo > 1) {
+    uint32 mid = (lo + hi) / 2;
+    if (_zones[mid].first_block <= block) lo = mid;
+    else hi = mid;
+  }
+  const HDD_Zone &z = _zones[lo];
+
+  /* determine track, sector & surface index within the zone */
+  // blocks are laid out sector by sector across all surfaces of a track
+  uint64 offset = block - z.first_block;
+  uint64 track_blocks = (uint64)z.sectors * _surfaces;
+
+  pos->track   = z.first_track + (uint32)(offset / track_blocks);
+  offset      %= track_blocks;
+  pos->sector  = (uint32)(offset / _surfaces);
+  pos->surface = (uint32)(offset % _surfaces);
+
+  return lo;
+}
+
+bool HDD::decode_sequential(uint64 block, HDD_Position *pos)
+{
+  if (!_cursor.valid || (block < _cursor.block) || (block - _cursor.block >= _cursor_window))
+    return false;
+
+  // advance from the end of the previous access one track at a time; the
+  // window limits this to a few iterations
+  uint32 z = _cursor.zone;
+  uint32 track = _cursor.track;
+  uint64 offset = _cursor.offset + (block - _cursor.block);
+  uint64 track_blocks = (uint64)_zones[z].sectors * _surfaces;
+
+  while (offset >= track_blocks) {
+    offset -= track_blocks;
+    track++;
+    if (track > _zones[z].last_track) {
+      z++;
+      track_blocks = (uint64)_zones[z].sectors * _surfaces;
+    }
+  }
+
+  pos->surface = (uint32)(offset % _surfaces);
+  pos->track = track;
+  pos->sector = (uint32)(offset / _surfaces);
+  _target_zone = z;
+
+  return true;
+}
+
+void HDD::print_stats(ostream &os)
+{
+  os.precision(3);
+  os << "HDD statistics:" << endl
+     << "  address translations:      " << dec << _decodes << endl
+     << "  sequential fast path:      " << dec << _sequential_decodes << endl
+     << "  fast path ratio:           " << fixed
+     << (_decodes > 0 ? (double)_sequential_decodes / _decodes : 0.0) << endl
+     << endl;
+}
+
+void HDD::reset_stats(void)
+{
+  _decodes = _sequential_decodes = 0;
+}
+
+bool HDD::save(ostream &os)
+{
+  // the model uses the average rotational latency; the head position and
+  // the end of the last access are the only mechanical state
+  ckpt_put_tag(os, "HDD ");
+  ckpt_put(os, _total_sectors);
+  ckpt_put(os, _head_pos);
+  ckpt_put(os, _target_pos.surface);
+  ckpt_put(os, _target_pos.track);
+  ckpt_put(os, _target_pos.sector);
+  ckpt_put(os, _target_pos.max_access);
+  ckpt_put(os, _target_block);
+  ckpt_put(os, _target_zone);
+  ckpt_put(os, _cursor.valid);
+  ckpt_put(os, _cursor.block);
+  ckpt_put(os, _cursor.track);
+  ckpt_put(os, _cursor.zone);
+  ckpt_put(os, _cursor.offset);
+  ckpt_put(os, _decodes);
+  ckpt_put(os, _sequential_decodes);
+
+  return os.good();
+}
+
+bool HDD::load(istream &is)
+{
+  if (!ckpt_get_tag(is, "HDD ") || !ckpt_check(is, _total_sectors, "HDD geometry"))
+    return false;
+
+  bool ok = ckpt_get(is, _head_pos) &&
+            ckpt_get(is, _target_pos.surface) &&
+            ckpt_get(is, _target_pos.track) &&
+            ckpt_get(is, _target_pos.sector) &&
+            ckpt_get(is, _target_pos.max_access) &&
+            ckpt_get(is, _target_block) &&
+            ckpt_get(is, _target_zone) &&
+            ckpt_get(is, _cursor.valid) &&
+            ckpt_get(is, _cursor.block) &&
+            ckpt_get(is, _cursor.track) &&
+            ckpt_get(is, _cursor.zone) &&
+            ckpt_get(is, _cursor.offset) &&
+            ckpt_get(is, _decodes) &&
+            ckpt_get(is, _sequential_decodes);
+
+  if (!ok || (_target_zone >= _zones.size()) || (_cursor.zone >= _zones.size())) {
+    cout << "Error: corrupt HDD state in checkpoint" << endl;
+    return false;
+  }
+
+  return true;
+}
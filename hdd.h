@@ -33,9 +33,16 @@
 #ifndef __CA_HDD_H__
 #define __CA_HDD_H__
 
+#include <iostream>
+#include <vector>
+
 #include "disk.h"
 using namespace std;
 
+// a request starting at most this many tracks after the end of the previous
+// access is translated incrementally from the end of that access
+#define HDD_CURSOR_TRACKS  4
+
 ///@brief struct encoding a byte position on the disk as a surface/track/sector 
 ///       triple.
 typedef struct _hdd_pos {
@@ -46,6 +53,27 @@ typedef struct _hdd_pos {
                                     ///< cutively until the end of this track
 } HDD_Position;
 
+///@brief struct describing a recording zone, i.e., a range of tracks with the
+///       same number of sectors per track.
+typedef struct _hdd_zone {
+  uint32 first_track;               ///< first track of the zone
+  uint32 last_track;                ///< last track of the zone (inclusive)
+  uint32 sectors;                   ///< sectors per track (on one surface)
+  uint64 first_block;               ///< index of the first block in the zone
+  int64  sector_ps;                 ///< time to pass one sector (picoseconds)
+} HDD_Zone;
+
+///@brief struct describing where the previous access ended. Addresses of
+///       sequential requests are translated incrementally from here.
+typedef struct _hdd_cursor {
+  bool   valid;                     ///< true once an access has completed
+  uint64 block;                     ///< first block after the previous access
+  uint32 track;                     ///< track of the previous access's end
+  uint32 zone;                      ///< zone of that track
+  uint64 offset;                    ///< offset of @a block within the cylinder
+                                    ///< (may equal the blocks per cylinder)
+} HDD_Cursor;
+
 //------------------------------------------------------------------------------
 /// @brief rotating disk-based storage devices (HDD)
 ///
@@ -56,16 +84,29 @@ class HDD : public Disk {
     /// @name constructor/destructor
     /// @{
 
-    /// @brief constructor
+    /// @brief constructor. The number of sectors per track grows linearly
+    ///        from the innermost to the outermost track.
     HDD(uint32 surfaces, uint32 tracks_per_surface,
         uint32 sectors_innermost_track, uint32 sectors_outermost_track,
         uint32 rpm, uint32 sector_size,
         double seek_overhead, double seek_per_track,
         bool verbose=false);
 
+    /// @brief constructor. The number of sectors per track is given by an
+    ///        explicit zone table.
+    /// @param zones zones ordered from the innermost to the outermost track;
+    ///        the tracks of the zones must be contiguous and start at 0
+    HDD(uint32 surfaces, const vector<HDD_Zone> &zones,
+        uint32 rpm, uint32 sector_size,
+        double seek_overhead, double seek_per_track,
+        bool verbose=false);
+
     /// @brief destructor
     virtual ~HDD(void);
 
+    /// @brief copy of the drive in its current state
+    virtual Disk* clone(void) const { return new HDD(*this); };
+
     /// @}
 
 
@@ -77,14 +118,19 @@ class HDD : public Disk {
     /// @param address starting address (in bytes) of data to read
     /// @param size number of bytes to read
     /// @retval time when the access ends (ts + latency of access)
-    virtual double read(double ts, uint64 address, uint64 size);
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
 
     /// @brief write @a size bytes to @a address
     /// @param ts timestamp of the event
     /// @param address starting address (in bytes) of data to write
     /// @param size number of bytes to write
     /// @retval time when the access ends (ts + latency of access)
-    virtual double write(double ts, uint64 address, uint64 size);
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @brief process a batch of requests in order. All addresses are
+    ///        decoded first, then the requests are costed in a second pass.
+    /// @param batch requests; completion times are stored in batch.done
+    virtual void process(const DiskBatch &batch);
 
     /// @}
 
@@ -93,40 +139,235 @@ class HDD : public Disk {
     /// @{
 
     /// @brief seek time to move the head from @from_track to @to_track
-    double seek_time(uint32 from_track, uint32 to_track);
+    simtime seek_time(uint32 from_track, uint32 to_track);
 
     /// @brief average rotational latency
-    double wait_time(void);
+    simtime wait_time(void);
 
     /// @brief time to read @sectors sectors
-    double read_time(uint64 sectors);
+    simtime read_time(uint64 sectors);
 
     /// @brief time to write @sectors sectors
-    double write_time(uint64 sectors);
+    simtime write_time(uint64 sectors);
+
+    /// @brief sustained sequential transfer rate on @a track
+    /// @param track track (cylinder)
+    /// @retval bytes/second including head and cylinder switches
+    double sequential_bandwidth(uint32 track);
+
+    /// @brief capacity of the disk (bytes)
+    uint64 capacity(void) const { return _total_sectors * _sector_size; };
+
+    /// @brief number of tracks per surface
+    uint32 tracks(void) const { return _tracks; };
+
+    /// @brief number of bytes per sector
+    uint32 sector_size(void) const { return _sector_size; };
+
+    /// @brief track (cylinder) holding @a address, without changing the
+    ///        state of the drive
+    /// @retval track, or tracks() if @a address is beyond the capacity
+    uint32 track(uint64 address) const;
+
+    /// @brief time to pass a single sector under the head on @a track
+    /// @retval time in picoseconds
+    int64  sector_time(uint32 track) const { return zone(track).sector_ps; };
+
+    /// @brief load a zone table from a file containing lines of the form
+    ///        "<first track> <last track> <sectors per track>"
+    /// @param filename file containing the zone table
+    /// @param zones (output) zone table
+    /// @retval true if the table was loaded successfully, false otherwise
+    static bool load_zones(const char *filename, vector<HDD_Zone> &zones);
+
+    /// @}
+
+
+    /// @name batch kernels
+    /// @{
+
+    /// @brief translate @a count byte addresses into positions. Uses AVX2 if
+    ///        the CPU supports it and the sector size is a power of two.
+    /// @param address byte addresses
+    /// @param count number of addresses
+    /// @param track (output) tracks
+    /// @param surface (output) surfaces
+    /// @param sector (output) sectors
+    /// @param valid (output) 1 if the address is on the disk, 0 otherwise
+    void   decode_batch(const uint64 *address, uint64 count,
+                        uint32 *track, uint32 *surface, uint32 *sector,
+                        uint8 *valid);
+
+    /// @brief seek times from track @a from[i] to track @a to[i] for @a count
+    ///        pairs of tracks. Uses AVX2 if the CPU supports it.
+    /// @param from tracks of the head
+    /// @param to target tracks
+    /// @param count number of pairs
+    /// @param time (output) seek times
+    void   seek_batch(const uint32 *from, const uint32 *to, uint64 count,
+                      simtime *time);
+
+    /// @}
+
+
+    /// @name seek profiles
+    /// @{
+
+    /// @brief replace the linear seek model by a piecewise sqrt/linear curve
+    ///        (all times in seconds).
+    ///        Seeks over d < @a boundary tracks take @a sqrt_overhead +
+    ///        @a sqrt_coeff * sqrt(d), longer seeks take @a linear_overhead +
+    ///        @a linear_coeff * d.
+    /// @param boundary seek distance (tracks) at which the curve becomes linear
+    /// @param sqrt_overhead constant part of short seeks
+    /// @param sqrt_coeff factor applied to the square root of the distance
+    /// @param linear_overhead constant part of long seeks
+    /// @param linear_coeff seek time per track of long seeks
+    void   set_seek_curve(uint32 boundary,
+                          double sqrt_overhead, double sqrt_coeff,
+                          double linear_overhead, double linear_coeff);
+
+    /// @brief replace the linear seek model by measured data. The file
+    ///        contains lines of the form "<distance> <seek time (s)>" with
+    ///        increasing distances; seek times in between are interpolated
+    ///        linearly, beyond the last point they are extrapolated.
+    /// @param filename file containing the seek table
+    /// @retval true if the table was loaded successfully, false otherwise
+    bool   load_seek_table(const char *filename);
+
+    /// @brief model head switches and track/cylinder skew in multi-track
+    ///        transfers. Without skew every cylinder boundary costs a seek
+    ///        plus the average rotational latency.
+    /// @param head_switch time to switch to another surface (seconds)
+    /// @param track_skew skew (sectors) between adjacent tracks of a cylinder,
+    ///        0 for the smallest skew that hides the head switch
+    /// @param cylinder_skew skew (sectors) between adjacent cylinders, 0 for
+    ///        the smallest skew that hides a single-track seek
+    void   set_skew(double head_switch, uint32 track_skew, uint32 cylinder_skew);
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief number of translated addresses
+    uint64 decodes(void) const { return _decodes; };
+
+    /// @brief number of addresses translated incrementally from the end of
+    ///        the previous access
+    uint64 sequential_decodes(void) const { return _sequential_decodes; };
+
+    /// @brief print address translation statistics
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @brief discard the statistics collected so far
+    virtual void reset_stats(void);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the head position, the sequential cursor and the
+    ///        statistics to a checkpoint
+    virtual bool save(ostream &os);
+
+    /// @brief restore the state written by save()
+    virtual bool load(istream &is);
 
     /// @}
 
 
   protected:
     uint32 _surfaces;               ///< number of surfaces
+    uint32 _tracks;                 ///< number of tracks per surface
     bool   _verbose;                ///< toggle verbose output
     uint32 _head_pos;               ///< current position (track) of r/w heads.
     uint32 _rpm;                    ///< rotations per minute
     uint32 _sector_size;            ///< number of bytes per sector
-    double _seek_overhead;          ///< seek overhead
+    double _seek_overhead;          ///< seek overhead (seconds)
     double _seek_per_track;         ///< seek time per track the head is moved
-    uint32 _sectors_innermost_track;///< number of sectors in innermost track
-    double _sectors_diff;           ///< sector number difference between tracks
+                                    ///< (seconds)
+    int64  _rotation_ps;            ///< time of one revolution (picoseconds)
+    vector<HDD_Zone> _zones;        ///< recording zones
+    uint64 _total_sectors;          ///< number of sectors on all surfaces
     double _capacity;               ///< capacity of disk (GB)
     HDD_Position _target_pos;          ///< block position of desired address
+    uint64 _target_block;           ///< block of desired address
+    uint32 _target_zone;            ///< zone of desired address
+    HDD_Cursor _cursor;             ///< end of the previous access
+    uint64 _cursor_window;          ///< largest distance (blocks) translated
+                                    ///< incrementally from _cursor
+    uint64 _decodes;                ///< number of translated addresses
+    uint64 _sequential_decodes;     ///< number of incremental translations
+    vector<simtime> _seek_table;    ///< seek time indexed by seek distance
+    bool   _skew;                   ///< true if skew is modeled
+    simtime _head_switch;           ///< head switch time
+    uint32 _track_skew;             ///< track skew (sectors, 0=auto)
+    uint32 _cylinder_skew;          ///< cylinder skew (sectors, 0=auto)
+    vector<uint32> _batch_track;    ///< decoded tracks of a batch
+    vector<uint32> _batch_surface;  ///< decoded surfaces of a batch
+    vector<uint32> _batch_sector;   ///< decoded sectors of a batch
+    vector<uint8>  _batch_valid;    ///< decode results of a batch
+    vector<uint8>  _batch_sequential; ///< requests continuing their predecessor
+    vector<uint64> _batch_address;  ///< addresses decoded by decode_batch
+    vector<int64>  _zone_first_block;   ///< zone first blocks, padded to a
+                                        ///< power of two for batch decoding
+    vector<int64>  _zone_first_track;   ///< zone first tracks (padded)
+    vector<int64>  _zone_track_blocks;  ///< blocks per track of each zone
+                                        ///< on all surfaces (padded)
     // TODO add more fields as necessary
 
 
-    /// @brief translate a byte address into a position on the HDD
+    /// @brief translate a byte address into a position on the HDD. The block
+    ///        and zone of the address are stored in _target_block/_target_zone.
     /// @param address byte address
     /// @param pos (output) pointer to result
     /// @retval true if translation was successful, false otherwise
     bool   decode(uint64 address, HDD_Position *pos);
+
+    /// @brief translate @a block from the zone table. Unlike decode(), it
+    ///        changes neither the statistics nor the cursor or _target_*.
+    /// @param block block index (must be on the disk)
+    /// @param pos (output) pointer to result
+    /// @retval zone of @a block
+    uint32 locate(uint64 block, HDD_Position *pos) const;
+
+    /// @brief translate @a block incrementally from the end of the previous
+    ///        access
+    /// @param block block index (must be on the disk)
+    /// @param pos (output) pointer to result
+    /// @retval true if @a block is close enough after _cursor, false otherwise
+    bool   decode_sequential(uint64 block, HDD_Position *pos);
+
+    /// @brief initialize the head position, transfer model and the linear
+    ///        seek table
+    void   init(void);
+
+    /// @brief compute the first block of every zone and the capacity
+    /// @retval true if the zone table is valid, false otherwise
+    bool   setup_zones(void);
+
+    /// @brief zone containing @a track
+    const HDD_Zone& zone(uint32 track) const;
+
+    /// @brief number of sectors per track (on one surface) of @a track
+    uint32 track_sectors(uint32 track) const { return zone(track).sectors; };
+
+    /// @brief time to transfer @a sectors sectors starting at _target_pos.
+    ///        Moves _cursor to the end of the transfer.
+    simtime transfer_time(uint64 sectors);
+
+    /// @brief time until the next logical sector is under the head after a
+    ///        head switch or single-track seek on @a track
+    /// @param track track (cylinder) after the switch
+    /// @param settle time the switch or seek takes
+    /// @param skew skew in sectors, 0 for the smallest skew covering @a settle
+    /// @retval time in picoseconds
+    int64  switch_time(uint32 track, simtime settle, uint32 skew);
     
 
     // TODO
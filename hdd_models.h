@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+/// @brief drive models with compile-time geometry
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_HDD_MODELS_H__
+#define __CA_HDD_MODELS_H__
+
+#include "disk.h"
+
+//------------------------------------------------------------------------------
+// Drive models for FixedHDD. Every model provides its name, geometry and seek
+// parameters as compile-time constants; zone_table lists the last track and
+// the number of sectors per track of every zone, innermost zone first.
+//
+
+/// @brief 7200 rpm desktop drive, 4 surfaces, 512-byte sectors
+struct Desktop7200 {
+  static const char* name(void) { return "desktop-7200"; };
+  static constexpr uint32 surfaces       = 4;
+  static constexpr uint32 sector_size    = 512;
+  static constexpr uint32 rpm            = 7200;
+  static constexpr double seek_overhead  = 0.002;
+  static constexpr double seek_per_track = 0.0000001;
+  static constexpr uint32 zones          = 16;
+  static constexpr uint32 zone_table[zones][2] = {
+    {   3999,  900 }, {   7999,  960 }, {  11999, 1020 }, {  15999, 1080 },
+    {  19999, 1140 }, {  23999, 1200 }, {  27999, 1260 }, {  31999, 1320 },
+    {  35999, 1380 }, {  39999, 1440 }, {  43999, 1500 }, {  47999, 1560 },
+    {  51999, 1620 }, {  55999, 1680 }, {  59999, 1740 }, {  63999, 1800 }
+  };
+};
+
+/// @brief 15000 rpm enterprise drive, 8 surfaces, 4096-byte sectors
+struct Enterprise15K {
+  static const char* name(void) { return "enterprise-15k"; };
+  static constexpr uint32 surfaces       = 8;
+  static constexpr uint32 sector_size    = 4096;
+  static constexpr uint32 rpm            = 15000;
+  static constexpr double seek_overhead  = 0.0012;
+  static constexpr double seek_per_track = 0.00000006;
+  static constexpr uint32 zones          = 12;
+  static constexpr uint32 zone_table[zones][2] = {
+    {   4999,  110 }, {   9999,  120 }, {  14999,  130 }, {  19999,  140 },
+    {  24999,  150 }, {  29999,  160 }, {  34999,  170 }, {  39999,  180 },
+    {  44999,  190 }, {  49999,  200 }, {  54999,  210 }, {  59999,  220 }
+  };
+};
+
+#endif // __CA_HDD_MODELS_H__
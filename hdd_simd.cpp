@@ -0,0 +1,258 @@
+//------------------------------------------------------------------------------
+/// @brief batch address decode kernel for HDD
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdlib>
+
+#include "hdd.h"
+using namespace std;
+
+// the AVX2 kernels require GCC/Clang on x86; other targets use the scalar
+// code only
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HDD_AVX2
+#include <immintrin.h>
+#endif
+
+
+#ifdef HDD_AVX2
+//------------------------------------------------------------------------------
+// AVX2 kernels
+//
+
+/// @brief true if the CPU supports AVX2
+static bool detect_avx2(void)
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+}
+
+/// @brief true if the CPU supports AVX2 (checked once, thread-safe)
+static bool have_avx2(void)
+{
+  static const bool avx2 = detect_avx2();
+
+  return avx2;
+}
+
+/// @brief convert four 64-bit integers in [0, 2^52) to doubles
+__attribute__((target("avx2")))
+static inline __m256d u64_to_pd(__m256i x)
+{
+  const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL); // 2^52
+  return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(x, magic)),
+                       _mm256_set1_pd(4503599627370496.0));
+}
+
+/// @brief convert four integral doubles in [0, 2^52) to 64-bit integers
+__attribute__((target("avx2")))
+static inline __m256i pd_to_u64(__m256d x)
+{
+  const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL); // 2^52
+  x = _mm256_add_pd(x, _mm256_set1_pd(4503599627370496.0));
+  return _mm256_xor_si256(_mm256_castpd_si256(x), magic);
+}
+
+/// @brief four unsigned divisions n / d with n < 2^52 and d, n/d < 2^32
+/// @param n dividends
+/// @param d divisors
+/// @param rem (output) remainders
+/// @retval quotients
+__attribute__((target("avx2")))
+static inline __m256i divmod_u64(__m256i n, __m256i d, __m256i *rem)
+{
+  // the quotient of the rounded division may be off by one; fix it up using
+  // the exact remainder
+  __m256d qd = _mm256_floor_pd(_mm256_div_pd(u64_to_pd(n), u64_to_pd(d)));
+  __m256i q  = pd_to_u64(qd);
+  __m256i r  = _mm256_sub_epi64(n, _mm256_mul_epu32(q, d));
+
+  __m256i neg = _mm256_cmpgt_epi64(_mm256_setzero_si256(), r);
+  q = _mm256_add_epi64(q, neg);
+  r = _mm256_add_epi64(r, _mm256_and_si256(neg, d));
+
+  __m256i big = _mm256_xor_si256(_mm256_cmpgt_epi64(d, r), _mm256_set1_epi64x(-1));
+  q = _mm256_sub_epi64(q, big);
+  r = _mm256_sub_epi64(r, _mm256_and_si256(big, d));
+
+  *rem = r;
+  return q;
+}
+
+/// @brief store the low 32 bits of four 64-bit lanes
+__attribute__((target("avx2")))
+static inline void store_lo32(uint32 *dst, __m256i x)
+{
+  const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  __m256i packed = _mm256_permutevar8x32_epi32(x, even);
+  _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(packed));
+}
+
+/// @brief decode addresses four at a time
+/// @retval number of addresses decoded (a multiple of four)
+__attribute__((target("avx2")))
+static uint64 decode_avx2(const uint64 *address, uint64 count,
+                          uint32 shift, uint64 total_blocks, uint32 surfaces,
+                          const int64 *zone_first_block,
+                          const int64 *zone_first_track,
+                          const int64 *zone_track_blocks, uint32 zones,
+                          uint32 *track, uint32 *surface, uint32 *sector,
+                          uint8 *valid)
+{
+  const __m256i total = _mm256_set1_epi64x((long long)total_blocks);
+  const __m256i surf  = _mm256_set1_epi64x(surfaces);
+  const long long *zfb = (const long long*)zone_first_block;
+  const long long *zft = (const long long*)zone_first_track;
+  const long long *ztb = (const long long*)zone_track_blocks;
+  uint64 i;
+
+  for (i = 0; i + 4 <= count; i += 4) {
+    __m256i adr = _mm256_loadu_si256((const __m256i*)(address + i));
+    __m256i blk = _mm256_srli_epi64(adr, shift);
+    __m256i ok  = _mm256_cmpgt_epi64(total, blk);
+
+    // branchless binary search for the last zone starting at or before blk.
+    // Out-of-range addresses may pick any zone; their results are unused.
+    blk = _mm256_and_si256(blk, ok);
+    __m256i zone = _mm256_setzero_si256();
+    for (uint32 step = zones >> 1; step > 0; step >>= 1) {
+      __m256i cand = _mm256_add_epi64(zone, _mm256_set1_epi64x(step));
+      __m256i fb   = _mm256_i64gather_epi64(zfb, cand, 8);
+      __m256i le   = _mm256_xor_si256(_mm256_cmpgt_epi64(fb, blk), _mm256_set1_epi64x(-1));
+      zone = _mm256_blendv_epi8(zone, cand, le);
+    }
+
+    __m256i fb  = _mm256_i64gather_epi64(zfb, zone, 8);
+    __m256i ft  = _mm256_i64gather_epi64(zft, zone, 8);
+    __m256i tb  = _mm256_i64gather_epi64(ztb, zone, 8);
+
+    // blocks are laid out sector by sector across all surfaces of a track
+    __m256i off, rem;
+    __m256i trk = _mm256_add_epi64(ft, divmod_u64(_mm256_sub_epi64(blk, fb), tb, &off));
+    __m256i sec = divmod_u64(off, surf, &rem);
+
+    store_lo32(track + i, trk);
+    store_lo32(sector + i, sec);
+    store_lo32(surface + i, rem);
+
+    int mask = _mm256_movemask_pd(_mm256_castsi256_pd(ok));
+    valid[i+0] = (mask >> 0) & 1;
+    valid[i+1] = (mask >> 1) & 1;
+    valid[i+2] = (mask >> 2) & 1;
+    valid[i+3] = (mask >> 3) & 1;
+  }
+
+  return i;
+}
+
+/// @brief seek times from the seek table, four pairs of tracks at a time
+/// @retval number of seek times computed (a multiple of four)
+__attribute__((target("avx2")))
+static uint64 seek_avx2(const uint32 *from, const uint32 *to, uint64 count,
+                        const simtime *table, uint32 size, simtime *time)
+{
+  const __m128i last = _mm_set1_epi32((int)(size - 1));
+  uint64 i;
+
+  for (i = 0; i + 4 <= count; i += 4) {
+    __m128i f = _mm_loadu_si128((const __m128i*)(from + i));
+    __m128i t = _mm_loadu_si128((const __m128i*)(to + i));
+    __m128i d = _mm_sub_epi32(_mm_max_epu32(f, t), _mm_min_epu32(f, t));
+    __m256i s = _mm256_i32gather_epi64((const long long*)table,
+                                       _mm_min_epu32(d, last), 8);
+    _mm256_storeu_si256((__m256i*)(time + i), s);
+  }
+
+  return i;
+}
+#endif // HDD_AVX2
+
+
+//------------------------------------------------------------------------------
+// HDD batch kernels
+//
+void HDD::decode_batch(const uint64 *address, uint64 count,
+                       uint32 *track, uint32 *surface, uint32 *sector,
+                       uint8 *valid)
+{
+  uint64 i = 0;
+
+#ifdef HDD_AVX2
+  // the vector kernel shifts instead of dividing by the sector size and
+  // requires track and block numbers to fit into 32 and 52 bits
+  bool pow2 = (_sector_size & (_sector_size - 1)) == 0;
+
+  if (have_avx2() && pow2 && (_total_sectors < (1ULL << 52)) && !_verbose) {
+    uint32 shift = 0;
+    while ((1U << shift) < _sector_size) shift++;
+
+    i = decode_avx2(address, count, shift, _total_sectors, _surfaces,
+                    &_zone_first_block[0], &_zone_first_track[0],
+                    &_zone_track_blocks[0], _zone_first_block.size(),
+                    track, surface, sector, valid);
+  }
+#endif
+
+  // scalar fallback and remainder. Like the vector kernel, it leaves the
+  // statistics and the cursor to the caller.
+  for (; i < count; i++) {
+    HDD_Position pos;
+
+    if (address[i] < _total_sectors * _sector_size) {
+      locate(address[i] / _sector_size, &pos);
+      valid[i]   = 1;
+      track[i]   = pos.track;
+      surface[i] = pos.surface;
+      sector[i]  = pos.sector;
+    } else {
+      valid[i]   = 0;
+      track[i]   = 0;
+      surface[i] = 0;
+      sector[i]  = 0;
+    }
+  }
+}
+
+void HDD::seek_batch(const uint32 *from, const uint32 *to, uint64 count,
+                     simtime *time)
+{
+  uint64 i = 0;
+
+#ifdef HDD_AVX2
+  // the gather takes signed 32-bit indices
+  if (have_avx2() && (_seek_table.size() < (1ULL << 31)))
+    i = seek_avx2(from, to, count, &_seek_table[0], _seek_table.size(), time);
+#endif
+
+  for (; i < count; i++)
+    time[i] = seek_time(from[i], to[i]);
+}
@@ -0,0 +1,469 @@
+//------------------------------------------------------------------------------
+/// @brief hybrid (tiered) storage devices
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <iostream>
+#include <iomanip>
+
+#include "checkpoint.h"
+#include "hybrid.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// HybridDisk
+//
+HybridDisk::HybridDisk(Disk *fast, Disk *slow, CacheMode mode,
+                       uint64 cache_blocks, uint32 block_size,
+                       uint32 promote_threshold,
+                       bool verbose)
+  : _fast(fast), _slow(slow), _mode(mode),
+    _cache_blocks(cache_blocks), _block_size(block_size),
+    _promote_threshold(promote_threshold), _verbose(verbose)
+{
+  if (_block_size == 0) {
+    cout << "Error: block size of hybrid device must not be zero" << endl;
+    _block_size = 4096;
+  }
+  if (_promote_threshold == 0) _promote_threshold = 1;
+
+  _fast_busy = _slow_busy = 0;
+  _accesses = 0;
+
+  // all slots are free initially; hand out low slots first
+  for (uint64 s = _cache_blocks; s > 0; s--)
+    _free_slots.push_back(s-1);
+
+  _read_hits = _read_misses = 0;
+  _write_hits = _write_misses = 0;
+  _promotions = _demotions = _writebacks = 0;
+
+  //
+  // print info
+  //
+  cout << "Hybrid: " << endl
+       << "  mode:                      "
+       << (_mode == WRITE_THROUGH ? "write-through" :
+           _mode == WRITE_BACK ? "write-back" : "write-around") << endl
+       << "  cache blocks:              " << _cache_blocks << endl
+       << "  block size:                " << _block_size << endl
+       << "  promotion threshold:       " << _promote_threshold << endl
+       << endl;
+}
+
+HybridDisk::~HybridDisk(void)
+{
+  delete _fast;
+  delete _slow;
+}
+
+Disk* HybridDisk::clone(void) const
+{
+  Disk *fast = _fast->clone();
+  Disk *slow = _slow->clone();
+
+  if ((fast == NULL) || (slow == NULL)) {
+    delete fast;
+    delete slow;
+    return NULL;
+  }
+
+  HybridDisk *h = new HybridDisk(*this);
+  h->_fast = fast;
+  h->_slow = slow;
+
+  return h;
+}
+
+void HybridDisk::scale_capacity(double rate)
+{
+  if (!_lines.empty() || (_cache_blocks == 0)) return;
+
+  _cache_blocks = (uint64)(_cache_blocks * rate + 0.5);
+  if (_cache_blocks == 0) _cache_blocks = 1;
+
+  _free_slots.clear();
+  for (uint64 s = _cache_blocks; s > 0; s--)
+    _free_slots.push_back(s-1);
+
+  _slow->scale_capacity(rate);
+}
+
+simtime HybridDisk::read(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "HybridDisk::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, false);
+}
+
+simtime HybridDisk::write(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "HybridDisk::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, true);
+}
+
+double HybridDisk::hit_ratio(void) const
+{
+  uint64 hits = _read_hits + _write_hits;
+  uint64 total = hits + _read_misses + _write_misses;
+
+  return total > 0 ? (double)hits / total : 0.0;
+}
+
+void HybridDisk::print_stats(ostream &os)
+{
+  uint64 reads = _read_hits + _read_misses;
+  uint64 dirty = 0;
+
+  for (map<uint64, CacheLine>::iterator it = _lines.begin(); it != _lines.end(); it++)
+    if (it->second.dirty) dirty++;
+
+  os.precision(4);
+  os << "Hybrid statistics:" << endl
+     << "  read hits:                 " << dec << _read_hits << endl
+     << "  read misses:               " << _read_misses << endl
+     << "  write hits:                " << _write_hits << endl
+     << "  write misses:              " << _write_misses << endl
+     << "  read hit ratio:            " << fixed
+     << (reads > 0 ? (double)_read_hits / reads : 0.0) << endl
+     << "  hit ratio:                 " << fixed << hit_ratio() << endl
+     << "  promotions:                " << _promotions << endl
+     << "  demotions:                 " << _demotions << endl
+     << "  writebacks:                " << _writebacks << endl
+     << "  cached blocks (dirty):     " << _lines.size() << " (" << dirty << ")" << endl
+     << "  latency:" << endl;
+  _latency.print(os, "    ");
+  os << endl;
+}
+
+simtime HybridDisk::access(simtime ts, uint64 address, uint64 size, bool write)
+{
+  if (size == 0)
+    return ts;
+
+  simtime done = ts;
+  uint64 first = address / _block_size;
+  uint64 last  = (address + size - 1) / _block_size;
+  uint64 run_adr = 0, run_size = 0;   // pending access to the slow device
+  vector<uint64> promote_list;        // blocks to promote after the request
+
+  for (uint64 b = first; b <= last; b++) {
+    uint64 lo = max(address, b * _block_size);
+    uint64 hi = min(address + size, (b + 1) * _block_size);
+    uint32 freq = touch(b);
+    bool   to_fast = false, to_slow = false;
+    simtime fast_ts = ts;
+
+    map<uint64, CacheLine>::iterator it = _lines.find(b);
+    if (it != _lines.end()) {
+      _lfu.erase(make_pair(it->second.freq, b));
+      it->second.freq = freq;
+      _lfu.insert(make_pair(freq, b));
+    }
+    bool cached = (it != _lines.end());
+
+    if (!write) {
+      if (cached) { _read_hits++; to_fast = true; }
+      else {
+        _read_misses++; to_slow = true;
+        if (freq >= _promote_threshold) promote_list.push_back(b);
+      }
+    } else {
+      switch (_mode) {
+        case WRITE_THROUGH:
+          // update both copies
+          if (cached) { _write_hits++; to_fast = true; }
+          else {
+            _write_misses++;
+            if (freq >= _promote_threshold) promote_list.push_back(b);
+          }
+          to_slow = true;
+          break;
+
+        case WRITE_BACK:
+          // absorb the write on the fast device, allocating on promotion
+          if (!cached && (freq >= _promote_threshold) && (_cache_blocks > 0)) {
+            fast_ts = promote(ts, b, hi - lo < _block_size);
+            it = _lines.find(b);
+            cached = true;
+            _write_misses++;
+          } else if (cached) _write_hits++;
+          else _write_misses++;
+
+          if (cached) { it->second.dirty = true; to_fast = true; }
+          else to_slow = true;
+          break;
+
+        case WRITE_AROUND:
+          // bypass the fast device and invalidate a stale copy
+          if (cached) {
+            _lfu.erase(make_pair(it->second.freq, b));
+            _free_slots.push_back(it->second.slot);
+            _lines.erase(it);
+          }
+          _write_misses++;
+          to_slow = true;
+          break;
+      }
+    }
+
+    if (to_fast) {
+      it = _lines.find(b);
+      done = max(done, issue(_fast, _fast_busy, write, fast_ts,
+                             it->second.slot * _block_size + (lo - b * _block_size),
+                             hi - lo));
+    }
+
+    // coalesce contiguous chunks for the slow device into a single access
+    if (to_slow && (run_size > 0) && (run_adr + run_size == lo)) {
+      run_size += hi - lo;
+    } else {
+      if (run_size > 0)
+        done = max(done, issue(_slow, _slow_busy, write, ts, run_adr, run_size));
+      run_adr = lo;
+      run_size = to_slow ? hi - lo : 0;
+    }
+  }
+
+  if (run_size > 0)
+    done = max(done, issue(_slow, _slow_busy, write, ts, run_adr, run_size));
+
+  // migrate hot blocks in the background once the request has completed
+  for (uint32 i = 0; i < promote_list.size(); i++) {
+    if ((_cache_blocks > 0) && (_lines.find(promote_list[i]) == _lines.end()))
+      promote(done, promote_list[i], true);
+  }
+
+  _latency.add(done - ts);
+
+  return done;
+}
+
+simtime HybridDisk::issue(Disk *disk, simtime &busy, bool write,
+                          simtime ts, uint64 address, uint64 size)
+{
+  simtime start = max(ts, busy);
+
+  busy = write ? disk->write(start, address, size) : disk->read(start, address, size);
+
+  return busy;
+}
+
+void HybridDisk::reset_stats(void)
+{
+  _read_hits = _read_misses = 0;
+  _write_hits = _write_misses = 0;
+  _promotions = _demotions = _writebacks = 0;
+  _latency.reset();
+
+  _fast->reset_stats();
+  _slow->reset_stats();
+}
+
+void HybridDisk::set_accuracy(double alpha)
+{
+  _latency.set_accuracy(alpha);
+
+  _fast->set_accuracy(alpha);
+  _slow->set_accuracy(alpha);
+}
+
+bool HybridDisk::save(ostream &os)
+{
+  ckpt_put_tag(os, "HYBR");
+  ckpt_put(os, _cache_blocks);
+  ckpt_put(os, _block_size);
+  ckpt_put(os, _fast_busy);
+  ckpt_put(os, _slow_busy);
+  ckpt_put(os, _accesses);
+
+  ckpt_put(os, (uint64)_freq.size());
+  for (map<uint64, uint32>::iterator it = _freq.begin(); it != _freq.end(); it++) {
+    ckpt_put(os, it->first);
+    ckpt_put(os, it->second);
+  }
+
+  // the LFU order is derived from the cache lines and rebuilt on load
+  ckpt_put(os, (uint64)_lines.size());
+  for (map<uint64, CacheLine>::iterator it = _lines.begin(); it != _lines.end(); it++) {
+    ckpt_put(os, it->first);
+    ckpt_put(os, it->second.slot);
+    ckpt_put(os, it->second.freq);
+    ckpt_put(os, it->second.dirty);
+  }
+  ckpt_put(os, _free_slots);
+
+  ckpt_put(os, _read_hits);
+  ckpt_put(os, _read_misses);
+  ckpt_put(os, _write_hits);
+  ckpt_put(os, _write_misses);
+  ckpt_put(os, _promotions);
+  ckpt_put(os, _demotions);
+  ckpt_put(os, _writebacks);
+  _latency.save(os);
+
+  return _fast->save(os) && _slow->save(os) && os.good();
+}
+
+bool HybridDisk::load(istream &is)
+{
+  uint64 n;
+
+  if (!ckpt_get_tag(is, "HYBR") ||
+      !ckpt_check(is, _cache_blocks, "cache size") ||
+      !ckpt_check(is, _block_size, "cache block size"))
+    return false;
+
+  bool ok = ckpt_get(is, _fast_busy) && ckpt_get(is, _slow_busy) &&
+            ckpt_get(is, _accesses) && ckpt_get(is, n);
+
+  _freq.clear();
+  for (uint64 i = 0; ok && (i < n); i++) {
+    uint64 block;
+    uint32 freq;
+    ok = ckpt_get(is, block) && ckpt_get(is, freq);
+    if (ok) _freq[block] = freq;
+  }
+
+  _lines.clear();
+  _lfu.clear();
+  ok = ok && ckpt_get(is, n) && (n <= _cache_blocks);
+  for (uint64 i = 0; ok && (i < n); i++) {
+    uint64 block;
+    CacheLine line;
+    ok = ckpt_get(is, block) && ckpt_get(is, line.slot) &&
+         ckpt_get(is, line.freq) && ckpt_get(is, line.dirty);
+    if (ok) {
+      _lines[block] = line;
+      _lfu.insert(make_pair(line.freq, block));
+    }
+  }
+
+  ok = ok && ckpt_get(is, _free_slots) &&
+       ckpt_get(is, _read_hits) && ckpt_get(is, _read_misses) &&
+       ckpt_get(is, _write_hits) && ckpt_get(is, _write_misses) &&
+       ckpt_get(is, _promotions) && ckpt_get(is, _demotions) &&
+       ckpt_get(is, _writebacks) && _latency.load(is);
+
+  if (!ok || (_lines.size() + _free_slots.size() != _cache_blocks)) {
+    cout << "Error: corrupt hybrid cache state in checkpoint" << endl;
+    return false;
+  }
+
+  return _fast->load(is) && _slow->load(is);
+}
+
+
+uint32 HybridDisk::touch(uint64 block)
+{
+  // periodically decay the frequencies so that the policy follows shifts in
+  // the working set and the frequency table stays bounded
+  if (++_accesses > 8 * max(_cache_blocks, (uint64)1024))
+    age();
+
+  return ++_freq[block];
+}
+
+void HybridDisk::age(void)
+{
+  map<uint64, uint32>::iterator it = _freq.begin();
+
+  while (it != _freq.end()) {
+    it->second >>= 1;
+    if (it->second == 0) _freq.erase(it++);
+    else it++;
+  }
+
+  _lfu.clear();
+  for (map<uint64, CacheLine>::iterator l = _lines.begin(); l != _lines.end(); l++) {
+    l->second.freq >>= 1;
+    _lfu.insert(make_pair(l->second.freq, l->first));
+  }
+
+  _accesses = 0;
+}
+
+simtime HybridDisk::promote(simtime ts, uint64 block, bool fill)
+{
+  simtime ready = ts;
+
+  if (_free_slots.empty())
+    ready = demote(ts);
+
+  uint64 slot = _free_slots.back();
+  _free_slots.pop_back();
+
+  if (fill) {
+    simtime fetched = issue(_slow, _slow_busy, false, ts, block * _block_size, _block_size);
+    ready = issue(_fast, _fast_busy, true, max(ready, fetched),
+                  slot * _block_size, _block_size);
+  }
+
+  CacheLine line;
+  line.slot  = slot;
+  line.freq  = _freq[block];
+  line.dirty = false;
+  _lines[block] = line;
+  _lfu.insert(make_pair(line.freq, block));
+  _promotions++;
+
+  if (_verbose)
+    cout << "HybridDisk::promote(" << block << ") -> slot " << slot << endl;
+
+  return ready;
+}
+
+simtime HybridDisk::demote(simtime ts)
+{
+  uint64 victim = _lfu.begin()->second;
+  map<uint64, CacheLine>::iterator it = _lines.find(victim);
+  simtime done = ts;
+
+  if (it->second.dirty) {
+    done = issue(_fast, _fast_busy, false, ts, it->second.slot * _block_size, _block_size);
+    done = issue(_slow, _slow_busy, true, done, victim * _block_size, _block_size);
+    _writebacks++;
+  }
+
+  if (_verbose)
+    cout << "HybridDisk::demote(" << victim << ") from slot " << it->second.slot << endl;
+
+  _free_slots.push_back(it->second.slot);
+  _lfu.erase(_lfu.begin());
+  _lines.erase(it);
+  _demotions++;
+
+  return done;
+}
@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+/// @brief hybrid (tiered) storage devices
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_HYBRID_H__
+#define __CA_HYBRID_H__
+
+#include <iostream>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "disk.h"
+#include "stats.h"
+using namespace std;
+
+///@brief write policy of a hybrid device
+typedef enum _cache_mode {
+  WRITE_THROUGH,                    ///< writes go to both devices
+  WRITE_BACK,                       ///< writes to cached blocks go to the fast
+                                    ///< device only and are written back on
+                                    ///< demotion
+  WRITE_AROUND,                     ///< writes bypass the fast device and
+                                    ///< invalidate cached copies
+} CacheMode;
+
+///@brief state of a block cached on the fast device
+typedef struct _cache_line {
+  uint64 slot;                      ///< block slot on the fast device
+  uint32 freq;                      ///< access frequency when last touched
+  bool   dirty;                     ///< true if newer than the slow device
+} CacheLine;
+
+//------------------------------------------------------------------------------
+/// @brief hybrid (tiered) storage devices
+///
+/// HybridDisk composes a fast device (typically an SSD) that caches blocks of
+/// a slow device (typically an HDD). Blocks are promoted to the fast device
+/// once their access frequency reaches a threshold and the least frequently
+/// used block is demoted when the cache is full. Promotion and demotion
+/// traffic is issued as regular accesses to both devices; each device serves
+/// one access at a time, so migrations delay subsequent requests.
+///
+class HybridDisk : public Disk {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor. The hybrid device takes ownership of @a fast and
+    ///        @a slow.
+    /// @param fast fast device (cache)
+    /// @param slow slow device (backing store)
+    /// @param mode write policy
+    /// @param cache_blocks number of blocks that fit on the fast device
+    /// @param block_size migration granularity (bytes)
+    /// @param promote_threshold number of accesses before a block is promoted
+    /// @param verbose toggle verbose output
+    HybridDisk(Disk *fast, Disk *slow, CacheMode mode,
+               uint64 cache_blocks, uint32 block_size,
+               uint32 promote_threshold,
+               bool verbose=false);
+
+    /// @brief destructor
+    virtual ~HybridDisk(void);
+
+    /// @brief copy of the hybrid device and both of its devices
+    virtual Disk* clone(void) const;
+
+    /// @brief scale the number of cache blocks by @a rate (at least one
+    ///        block). Ignored once blocks have been cached.
+    virtual void scale_capacity(double rate);
+
+    /// @}
+
+
+    /// @name access methods
+    /// @{
+
+    /// @brief read @a size bytes from @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to read
+    /// @param size number of bytes to read
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
+
+    /// @brief write @a size bytes to @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to write
+    /// @param size number of bytes to write
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief fraction of block accesses served by the fast device
+    double hit_ratio(void) const;
+
+    /// @brief print cache and latency statistics
+    /// @param os output stream
+    void print_stats(ostream &os);
+
+    /// @brief discard the statistics collected so far (including those
+    ///        of both devices)
+    virtual void reset_stats(void);
+
+    /// @brief keep latency distributions (including those of both
+    ///        devices) in sketches of relative accuracy @a alpha
+    virtual void set_accuracy(double alpha);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the cache contents, frequencies, statistics and the
+    ///        state of both devices to a checkpoint
+    virtual bool save(ostream &os);
+
+    /// @brief restore the state written by save()
+    virtual bool load(istream &is);
+
+    /// @}
+
+
+  protected:
+    Disk  *_fast;                   ///< fast device (cache)
+    Disk  *_slow;                   ///< slow device (backing store)
+    CacheMode _mode;                ///< write policy
+    uint64 _cache_blocks;           ///< capacity of the fast device (blocks)
+    uint32 _block_size;             ///< migration granularity (bytes)
+    uint32 _promote_threshold;      ///< accesses before a block is promoted
+    bool   _verbose;                ///< toggle verbose output
+
+    simtime _fast_busy;             ///< time at which the fast device is idle
+    simtime _slow_busy;             ///< time at which the slow device is idle
+
+    map<uint64, uint32> _freq;      ///< access frequency of recent blocks
+    uint64 _accesses;               ///< block accesses since last aging
+    map<uint64, CacheLine> _lines;  ///< cached blocks
+    set<pair<uint32, uint64> > _lfu;///< cached blocks ordered by frequency
+    vector<uint64> _free_slots;     ///< unused slots on the fast device
+
+    uint64 _read_hits;              ///< block reads served by the fast device
+    uint64 _read_misses;            ///< block reads served by the slow device
+    uint64 _write_hits;             ///< block writes to cached blocks
+    uint64 _write_misses;           ///< block writes to uncached blocks
+    uint64 _promotions;             ///< blocks promoted to the fast device
+    uint64 _demotions;              ///< blocks evicted from the fast device
+    uint64 _writebacks;             ///< dirty blocks written to the slow device
+    LatencyStats _latency;          ///< request latencies
+
+
+    /// @brief serve a read or write request
+    simtime access(simtime ts, uint64 address, uint64 size, bool write);
+
+    /// @brief issue an access to @a disk once it is idle
+    /// @param disk device to access
+    /// @param busy (in/out) time at which @a disk is idle
+    /// @param write true for writes, false for reads
+    /// @param ts earliest start time
+    /// @param address starting address (in bytes)
+    /// @param size number of bytes
+    /// @retval time when the access ends
+    simtime issue(Disk *disk, simtime &busy, bool write,
+                  simtime ts, uint64 address, uint64 size);
+
+    /// @brief count an access to @a block
+    /// @retval access frequency of @a block including this access
+    uint32 touch(uint64 block);
+
+    /// @brief halve all access frequencies (aging)
+    void   age(void);
+
+    /// @brief move @a block to the fast device
+    /// @param ts time at which the migration starts
+    /// @param block block to promote
+    /// @param fill true if the block's data must be read from the slow device
+    /// @retval time when the block is available on the fast device
+    simtime promote(simtime ts, uint64 block, bool fill);
+
+    /// @brief evict the least frequently used block from the fast device
+    /// @param ts time at which the migration starts
+    /// @retval time when the slot is free
+    simtime demote(simtime ts);
+};
+
+#endif // __CA_HYBRID_H__
@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+/// @brief parallel load sweep over time-compression factors
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include "load_sweep.h"
+#include "stats.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// LoadSweep
+//
+LoadSweep::LoadSweep(const Disk *device, uint32 threads)
+  : _device(device), _threads(threads), _accuracy(0.0)
+{
+  if (_threads == 0) _threads = thread::hardware_concurrency();
+  if (_threads == 0) _threads = 1;
+}
+
+uint64 LoadSweep::load(TraceSource *source)
+{
+  return _trace.load(source);
+}
+
+bool LoadSweep::run(double min_factor, double max_factor, uint32 points)
+{
+  vector<Disk*> devices;
+  atomic<uint32> next(0);
+  vector<thread> workers;
+
+  if (points == 0) points = 1;
+  _points.resize(points);
+
+  // copy the devices up front: the workers never touch the original
+  for (uint32 i = 0; i < points; i++) {
+    double step = points > 1 ? (double)i / (points - 1) : 0.0;
+
+    _points[i].factor = min_factor * pow(max_factor / min_factor, step);
+    devices.push_back(_device->clone());
+    if (devices.back() == NULL) {
+      cout << "Error: load sweeps are not supported on this device" << endl;
+      for (uint32 k = 0; k < devices.size(); k++) delete devices[k];
+      return false;
+    }
+  }
+
+  for (uint32 w = 0; w < min(_threads, points); w++) {
+    workers.push_back(thread([&]() {
+      uint32 i;
+      while ((i = next.fetch_add(1)) < points)
+        simulate(devices[i], _points[i]);
+    }));
+  }
+
+  for (uint32 w = 0; w < workers.size(); w++)
+    workers[w].join();
+  for (uint32 i = 0; i < points; i++)
+    delete devices[i];
+
+  return true;
+}
+
+void LoadSweep::simulate(Disk *device, LoadPoint &p)
+{
+  LatencyStats latency(_accuracy);
+  uint64 n = _trace.count();
+  simtime first = n > 0 ? _trace.ts(0) : 0;
+  simtime busy = 0, last = 0, arrival = 0;
+  double sum = 0.0;
+
+  for (uint64 i = 0; i < n; i++) {
+    // compress the time since the first request
+    arrival = _trace.arrival(i, p.factor);
+
+    simtime done = _trace.serve(device, i, arrival, busy);
+
+    last = max(last, done);
+    latency.add(done - arrival);
+    sum += to_seconds(done - arrival);
+  }
+
+  p.offered  = arrival > first ? (n - 1) / to_seconds(arrival - first) : 0.0;
+  p.achieved = last > first ? n / to_seconds(last - first) : 0.0;
+  // far beyond saturation, the sum of the latencies exceeds the range of
+  // simtime
+  p.mean = n > 0 ? sum / n : 0.0;
+  p.p50 = latency.percentile(50.0);
+  p.p99 = latency.percentile(99.0);
+}
+
+void LoadSweep::print_stats(ostream &os)
+{
+  int saturated = -1;
+  uint32 peak = 0;
+
+  os.precision(6);
+  os << "Load sweep statistics:" << endl
+     << "  requests per point:        " << dec << _trace.count() << endl
+     << "  threads:                   " << _threads << endl
+     << "   factor  offered IOPS achieved IOPS  mean latency   p50 latency   p99 latency" << endl;
+
+  for (uint32 i = 0; i < _points.size(); i++) {
+    const LoadPoint &p = _points[i];
+
+    if ((saturated < 0) && (p.achieved < LOAD_SWEEP_SATURATION * p.offered))
+      saturated = i;
+    if (p.achieved > _points[peak].achieved) peak = i;
+
+    os << "  " << setw(7) << setprecision(3) << p.factor
+       << setw(14) << setprecision(2) << p.offered
+       << setw(14) << p.achieved
+       << setw(14) << setprecision(6) << p.mean
+       << setw(14) << to_seconds(p.p50)
+       << setw(14) << to_seconds(p.p99) << endl;
+  }
+
+  if (!_points.empty())
+    os << "  saturation throughput:     " << setprecision(2) << _points[peak].achieved
+       << " IOPS" << endl;
+  if (saturated >= 0)
+    os << "  saturation point:          factor " << setprecision(3) << _points[saturated].factor
+       << " (offered " << setprecision(2) << _points[saturated].offered << " IOPS)" << endl;
+  else
+    os << "  saturation point:          not reached" << endl;
+  os << endl;
+}
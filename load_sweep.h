@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+/// @brief parallel load sweep over time-compression factors
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_LOAD_SWEEP_H__
+#define __CA_LOAD_SWEEP_H__
+
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+#include "trace_memory.h"
+#include "trace_source.h"
+using namespace std;
+
+// a point is saturated once the device completes less than this fraction of
+// the offered load
+#define LOAD_SWEEP_SATURATION  0.95
+
+///@brief result of one point of a load sweep
+typedef struct _load_point {
+  double factor;                    ///< time-compression factor
+  double offered;                   ///< offered load (requests/second)
+  double achieved;                  ///< completed requests/second
+  double mean;                      ///< mean latency (seconds)
+  simtime p50;                      ///< median latency
+  simtime p99;                      ///< 99th percentile latency
+} LoadPoint;
+
+//------------------------------------------------------------------------------
+/// @brief throughput-latency curve of a device
+///
+/// LoadSweep replays the requests of a trace at a series of time-compression
+/// factors: at factor f, the interarrival times are divided by f, so the
+/// offered load is f times that of the trace. The device serves one request
+/// at a time in the order of arrival; as the offered load approaches the
+/// service rate, the queueing delay grows. Every point is simulated on its
+/// own copy of the device (Disk::clone()), so the points run in parallel on
+/// separate threads.
+///
+/// The saturation point is the first factor at which the device completes
+/// less than LOAD_SWEEP_SATURATION of the offered load; the saturation
+/// throughput is the largest throughput of all points.
+///
+class LoadSweep {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param device device in its initial state (not owned, not modified)
+    /// @param threads number of threads (0: one per core)
+    LoadSweep(const Disk *device, uint32 threads=0);
+
+    /// @brief destructor
+    ~LoadSweep(void) {};
+
+    /// @}
+
+
+    /// @name simulation
+    /// @{
+
+    /// @brief read the requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief keep the latencies of a run in a sketch of relative accuracy
+    ///        @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha) { _accuracy = alpha; };
+
+    /// @brief simulate @a points factors spaced geometrically from
+    ///        @a min_factor to @a max_factor
+    /// @retval true on success, false if the device cannot be copied
+    bool   run(double min_factor, double max_factor, uint32 points);
+
+    /// @brief print the curve and the saturation point
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @}
+
+
+  protected:
+    const Disk *_device;            ///< initial device
+    uint32 _threads;                ///< number of threads
+    double _accuracy;               ///< accuracy of the latencies of a run
+    MemoryTrace _trace;             ///< requests
+    vector<LoadPoint> _points;      ///< results, by increasing factor
+
+
+    /// @brief simulate the requests at @a p.factor on @a device
+    void   simulate(Disk *device, LoadPoint &p);
+};
+
+#endif // __CA_LOAD_SWEEP_H__
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+/// @brief lock-free multi-producer/multi-consumer ring buffer
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_MPMC_H__
+#define __CA_MPMC_H__
+
+#include <atomic>
+
+#include "disk.h"
+#include "spsc.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief bounded lock-free queue for any number of producers and consumers
+///
+/// MPMCQueue is a ring buffer whose capacity is a power of two. Every slot
+/// carries a sequence number telling whether it is ready to be written or
+/// read in the current round; producers and consumers claim a position with
+/// a compare-and-swap on _tail or _head and then publish the slot through its
+/// sequence number. push() and pop() never block.
+///
+template <class T>
+class MPMCQueue {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param capacity minimal number of elements (rounded up to a power of 2)
+    MPMCQueue(uint64 capacity);
+
+    /// @brief destructor
+    ~MPMCQueue(void);
+
+    /// @}
+
+
+    /// @name queue operations
+    /// @{
+
+    /// @brief append @a value if the queue is not full
+    /// @retval true if @a value was appended, false if the queue was full
+    bool   push(const T &value);
+
+    /// @brief remove the oldest element if the queue is not empty
+    /// @param value (output) removed element
+    /// @retval true if an element was removed, false if the queue was empty
+    bool   pop(T &value);
+
+    /// @}
+
+
+  protected:
+    ///@brief slot of the ring buffer
+    typedef struct _mpmc_slot {
+      atomic<uint64> sequence;      ///< position the slot is ready for
+      T      value;                 ///< element
+    } Slot;
+
+    Slot  *_slots;                  ///< ring buffer
+    uint64 _mask;                   ///< capacity - 1
+    atomic<uint64> _head;           ///< next element to remove
+    char   _pad[SPSC_CACHE_LINE];   ///< keeps _head and _tail apart
+    atomic<uint64> _tail;           ///< next free slot
+
+    // not copyable
+    MPMCQueue(const MPMCQueue&);
+    MPMCQueue& operator=(const MPMCQueue&);
+};
+
+
+//------------------------------------------------------------------------------
+// MPMCQueue
+//
+template <class T>
+MPMCQueue<T>::MPMCQueue(uint64 capacity)
+  : _head(0), _tail(0)
+{
+  uint64 size = 1;
+  while (size < capacity) size <<= 1;
+
+  _slots = new Slot[size];
+  _mask = size - 1;
+  for (uint64 i = 0; i < size; i++)
+    _slots[i].sequence.store(i, memory_order_relaxed);
+}
+
+template <class T>
+MPMCQueue<T>::~MPMCQueue(void)
+{
+  delete[] _slots;
+}
+
+template <class T>
+bool MPMCQueue<T>::push(const T &value)
+{
+  uint64 pos = _tail.load(memory_order_relaxed);
+  Slot *slot;
+
+  while (1) {
+    slot = &_slots[pos & _mask];
+    int64 diff = (int64)(slot->sequence.load(memory_order_acquire) - pos);
+
+    if (diff == 0) {
+      // the slot is free in this round: claim it
+      if (_tail.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // the slot still holds an element of the previous round
+      return false;
+    } else {
+      pos = _tail.load(memory_order_relaxed);
+    }
+  }
+
+  slot->value = value;
+  slot->sequence.store(pos + 1, memory_order_release);
+
+  return true;
+}
+
+template <class T>
+bool MPMCQueue<T>::pop(T &value)
+{
+  uint64 pos = _head.load(memory_order_relaxed);
+  Slot *slot;
+
+  while (1) {
+    slot = &_slots[pos & _mask];
+    int64 diff = (int64)(slot->sequence.load(memory_order_acquire) - (pos + 1));
+
+    if (diff == 0) {
+      // the slot holds the element of this round: claim it
+      if (_head.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      // the slot has not been written yet
+      return false;
+    } else {
+      pos = _head.load(memory_order_relaxed);
+    }
+  }
+
+  value = slot->value;
+  slot->sequence.store(pos + _mask + 1, memory_order_release);
+
+  return true;
+}
+
+#endif // __CA_MPMC_H__
@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+/// @brief miss ratio curves of LRU caches
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+#include "mrc.h"
+#include "trace_sample.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// MissRatioCurve
+//
+MissRatioCurve::MissRatioCurve(uint32 block_size, double rate)
+  : _block_size(block_size > 0 ? block_size : 1), _rate(rate),
+    _threshold(SpatialSampler::threshold(rate)), _tree(MRC_TREE_SIZE + 1, 0),
+    _time(0), _requests(0), _accesses(0), _sampled(0), _cold(0)
+{
+}
+
+uint64 MissRatioCurve::load(TraceSource *source)
+{
+  TraceRecord r;
+
+  while (source->next(r)) {
+    if ((r.op != 'r') && (r.op != 'w')) continue;
+
+    uint64 last = (r.address + max(r.size, (uint64)1) - 1) / _block_size;
+    for (uint64 b = r.address / _block_size; b <= last; b++)
+      access(b);
+    _requests++;
+  }
+
+  return _requests;
+}
+
+void MissRatioCurve::access(uint64 block)
+{
+  _accesses++;
+  if (SpatialSampler::hash(block) >= _threshold) return;
+  _sampled++;
+
+  if (_time + 1 >= _tree.size()) compact();
+  _time++;
+
+  unordered_map<uint64, uint64>::iterator it = _last.find(block);
+  if (it == _last.end()) {
+    _cold++;
+    _last[block] = _time;
+  } else {
+    // distinct blocks whose latest access lies between the two accesses
+    uint64 d = prefix(_time - 1) - prefix(it->second);
+
+    if (d >= _distances.size()) _distances.resize(d + 1, 0);
+    _distances[d]++;
+
+    update(it->second, -1);
+    it->second = _time;
+  }
+
+  update(_time, 1);
+}
+
+double MissRatioCurve::hit_ratio(uint64 blocks) const
+{
+  uint64 hits = 0;
+
+  // a sampled distance d stands for d/rate blocks of the full trace
+  for (uint64 d = 0; (d < _distances.size()) && (d < blocks * _rate); d++)
+    hits += _distances[d];
+
+  return _sampled > 0 ? (double)hits / _sampled : 0.0;
+}
+
+void MissRatioCurve::update(uint64 t, int32 delta)
+{
+  for (; t < _tree.size(); t += t & (~t + 1))
+    _tree[t] += delta;
+}
+
+uint64 MissRatioCurve::prefix(uint64 t) const
+{
+  uint64 sum = 0;
+
+  for (; t > 0; t -= t & (~t + 1))
+    sum += _tree[t];
+
+  return sum;
+}
+
+void MissRatioCurve::compact(void)
+{
+  vector<pair<uint64, uint64> > order;
+  unordered_map<uint64, uint64>::iterator it;
+
+  for (it = _last.begin(); it != _last.end(); it++)
+    order.push_back(make_pair(it->second, it->first));
+  sort(order.begin(), order.end());
+
+  // the relative order of the latest accesses is all that matters
+  for (uint64 i = 0; i < order.size(); i++)
+    _last[order[i].second] = i + 1;
+  _time = order.size();
+
+  uint64 size = max(2 * _time, (uint64)MRC_TREE_SIZE);
+  _tree.assign(size + 1, 0);
+  for (uint64 t = 1; t <= size; t++) {
+    if (t <= _time) _tree[t]++;
+    uint64 parent = t + (t & (~t + 1));
+    if (parent <= size) _tree[parent] += _tree[t];
+  }
+}
+
+void MissRatioCurve::print_stats(ostream &os)
+{
+  uint64 distinct = (uint64)(_last.size() / _rate + 0.5);
+  uint64 hits = 0;
+
+  os.precision(6);
+  os << "Miss ratio curve (LRU):" << endl
+     << "  block size:                " << dec << _block_size << endl
+     << "  sampling rate:             " << fixed << _rate << endl
+     << "  requests:                  " << _requests << endl
+     << "  block accesses:            " << _accesses << endl
+     << "  sampled accesses:          " << _sampled << endl
+     << "  distinct blocks:           " << distinct << endl
+     << "  max. hit ratio:            " << setprecision(4)
+     << (_sampled > 0 ? 1.0 - (double)_cold / _sampled : 0.0) << endl
+     << "    cache blocks      cache MB  hit ratio miss ratio" << endl;
+
+  // accumulate the histogram once for all sizes
+  uint64 d = 0;
+  for (uint64 blocks = 1; ; blocks *= 2) {
+    for (; (d < _distances.size()) && (d < blocks * _rate); d++)
+      hits += _distances[d];
+
+    double hit = _sampled > 0 ? (double)hits / _sampled : 0.0;
+    os << "  " << setw(14) << blocks
+       << setw(14) << setprecision(2) << (double)blocks * _block_size / 1e6
+       << setw(11) << setprecision(4) << hit
+       << setw(11) << 1.0 - hit << endl;
+
+    if (blocks >= distinct) break;
+  }
+  os << endl;
+}
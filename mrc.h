@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+/// @brief miss ratio curves of LRU caches
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_MRC_H__
+#define __CA_MRC_H__
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+// initial number of access times covered by the reuse-distance tree
+#define MRC_TREE_SIZE  1024
+
+//------------------------------------------------------------------------------
+/// @brief single-pass miss ratio curve of an LRU cache
+///
+/// MissRatioCurve computes the hit ratio of an LRU cache of every size from
+/// one pass over the block accesses of a trace. A request accesses all
+/// blocks it overlaps. The reuse distance of an access is the number of
+/// distinct blocks accessed since the previous access to the same block; the
+/// access hits in an LRU cache of C blocks iff its reuse distance is less
+/// than C. Distances are counted in O(log n) with a Fenwick tree over the
+/// access times that marks the most recent access of every block. When the
+/// tree is full, the times are renumbered, so the memory is proportional to
+/// the number of distinct blocks.
+///
+/// With a sampling rate below one, only the blocks sampled by
+/// SpatialSampler::hash() are tracked (SHARDS); their reuse distances are
+/// scaled by 1/rate.
+///
+class MissRatioCurve {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param block_size cache block size (bytes)
+    /// @param rate sampling rate in (0, 1]
+    MissRatioCurve(uint32 block_size, double rate=1.0);
+
+    /// @brief destructor
+    ~MissRatioCurve(void) {};
+
+    /// @}
+
+
+    /// @name analysis
+    /// @{
+
+    /// @brief account the block accesses of all requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief account an access to block @a block
+    void   access(uint64 block);
+
+    /// @brief hit ratio of an LRU cache of @a blocks blocks
+    double hit_ratio(uint64 blocks) const;
+
+    /// @brief print the curve for power-of-two cache sizes up to the
+    ///        number of distinct blocks
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @}
+
+
+  protected:
+    uint32 _block_size;             ///< cache block size (bytes)
+    double _rate;                   ///< sampling rate
+    uint64 _threshold;              ///< hash threshold of the rate
+    unordered_map<uint64, uint64> _last;
+                                    ///< time of the last access of every
+                                    ///< sampled block
+    vector<uint32> _tree;           ///< Fenwick tree over the access times
+                                    ///< (1-based)
+    uint64 _time;                   ///< time of the latest sampled access
+    vector<uint64> _distances;      ///< histogram of the (unscaled) reuse
+                                    ///< distances of sampled accesses
+    uint64 _requests;               ///< requests
+    uint64 _accesses;               ///< block accesses
+    uint64 _sampled;                ///< sampled block accesses
+    uint64 _cold;                   ///< sampled first accesses to a block
+
+
+    /// @brief add @a delta to the mark at time @a t
+    void   update(uint64 t, int32 delta);
+
+    /// @brief number of marks at times up to @a t
+    uint64 prefix(uint64 t) const;
+
+    /// @brief renumber the access times 1..n and make room for as many
+    ///        new ones
+    void   compact(void);
+};
+
+#endif // __CA_MRC_H__
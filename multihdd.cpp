@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+/// @brief multi-actuator rotating disks
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <iostream>
+#include <iomanip>
+
+#include "checkpoint.h"
+#include "multihdd.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// MultiActuatorHDD
+//
+MultiActuatorHDD::MultiActuatorHDD(const vector<HDD*> &actuators,
+                                   double interface_bandwidth,
+                                   bool verbose)
+  : _actuators(actuators), _interface_bandwidth(interface_bandwidth),
+    _verbose(verbose)
+{
+  uint64 first = 0;
+
+  for (uint32 i = 0; i < _actuators.size(); i++) {
+    _first.push_back(first);
+    first += _actuators[i]->capacity();
+  }
+  _first.push_back(first);
+
+  _busy.assign(_actuators.size(), 0);
+  _busy_time.assign(_actuators.size(), 0);
+  _requests.assign(_actuators.size(), 0);
+
+  _first_arrival = _last_completion = 0;
+  _completed = 0;
+
+  //
+  // print info
+  //
+  cout.precision(3);
+  cout << "Multi-actuator HDD: " << endl
+       << "  actuators:                 " << _actuators.size() << endl
+       << "  interface (MB/s):          ";
+  if (_interface_bandwidth > 0.0) cout << fixed << _interface_bandwidth/1000000.0 << endl;
+  else cout << "unlimited" << endl;
+  cout << "  capacity (GB):             " << fixed << first/1000000000.0 << endl
+       << endl;
+}
+
+MultiActuatorHDD::~MultiActuatorHDD(void)
+{
+  for (uint32 i = 0; i < _actuators.size(); i++)
+    delete _actuators[i];
+}
+
+Disk* MultiActuatorHDD::clone(void) const
+{
+  MultiActuatorHDD *m = new MultiActuatorHDD(*this);
+
+  for (uint32 i = 0; i < _actuators.size(); i++)
+    m->_actuators[i] = static_cast<HDD*>(_actuators[i]->clone());
+
+  return m;
+}
+
+simtime MultiActuatorHDD::read(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "MultiActuatorHDD::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, false);
+}
+
+simtime MultiActuatorHDD::write(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "MultiActuatorHDD::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, true);
+}
+
+double MultiActuatorHDD::iops(void) const
+{
+  double span = to_seconds(_last_completion - _first_arrival);
+
+  return span > 0.0 ? _completed / span : 0.0;
+}
+
+void MultiActuatorHDD::print_stats(ostream &os)
+{
+  simtime span = _last_completion - _first_arrival;
+
+  os.precision(3);
+  os << "Multi-actuator statistics:" << endl;
+  for (uint32 i = 0; i < _actuators.size(); i++) {
+    os << "  actuator " << i << ":" << endl
+       << "    requests:     " << dec << _requests[i] << endl
+       << "    sequential:   " << dec << _actuators[i]->sequential_decodes() << endl
+       << "    utilization:  " << fixed << (span > 0 ? (double)_busy_time[i] / span : 0.0) << endl;
+  }
+  os << "  IOPS:                      " << fixed << iops() << endl
+     << "  latency:" << endl;
+  _latency.print(os, "    ");
+  os << endl;
+}
+
+void MultiActuatorHDD::reset_stats(void)
+{
+  // the actuators stay busy with requests issued before the reset
+  for (uint32 i = 0; i < _actuators.size(); i++) {
+    _busy_time[i] = 0;
+    _requests[i] = 0;
+    _actuators[i]->reset_stats();
+  }
+  _completed = 0;
+  _first_arrival = _last_completion = 0;
+  _latency.reset();
+}
+
+void MultiActuatorHDD::set_accuracy(double alpha)
+{
+  for (uint32 i = 0; i < _actuators.size(); i++)
+    _actuators[i]->set_accuracy(alpha);
+  _latency.set_accuracy(alpha);
+}
+
+bool MultiActuatorHDD::save(ostream &os)
+{
+  vector<simtime> start, end;
+  map<simtime, simtime>::const_iterator it;
+
+  for (it = _interface.begin(); it != _interface.end(); it++) {
+    start.push_back(it->first);
+    end.push_back(it->second);
+  }
+
+  ckpt_put_tag(os, "MACT");
+  ckpt_put(os, (uint32)_actuators.size());
+  ckpt_put(os, _busy);
+  ckpt_put(os, _busy_time);
+  ckpt_put(os, _requests);
+  ckpt_put(os, start);
+  ckpt_put(os, end);
+  ckpt_put(os, _first_arrival);
+  ckpt_put(os, _last_completion);
+  ckpt_put(os, _completed);
+  _latency.save(os);
+
+  for (uint32 i = 0; i < _actuators.size(); i++)
+    if (!_actuators[i]->save(os)) return false;
+
+  return os.good();
+}
+
+bool MultiActuatorHDD::load(istream &is)
+{
+  vector<simtime> start, end;
+
+  if (!ckpt_get_tag(is, "MACT") ||
+      !ckpt_check(is, (uint32)_actuators.size(), "number of actuators"))
+    return false;
+
+  bool ok = ckpt_get(is, _busy) && ckpt_get(is, _busy_time) &&
+            ckpt_get(is, _requests) && ckpt_get(is, start) && ckpt_get(is, end) &&
+            ckpt_get(is, _first_arrival) && ckpt_get(is, _last_completion) &&
+            ckpt_get(is, _completed) && _latency.load(is);
+
+  if (!ok || (_busy.size() != _actuators.size()) ||
+      (_busy_time.size() != _actuators.size()) ||
+      (_requests.size() != _actuators.size()) || (start.size() != end.size())) {
+    cout << "Error: corrupt multi-actuator state in checkpoint" << endl;
+    return false;
+  }
+
+  _interface.clear();
+  for (uint64 i = 0; i < start.size(); i++)
+    _interface[start[i]] = end[i];
+
+  for (uint32 i = 0; i < _actuators.size(); i++)
+    if (!_actuators[i]->load(is)) return false;
+
+  return true;
+}
+
+simtime MultiActuatorHDD::access(simtime ts, uint64 address, uint64 size, bool write)
+{
+  simtime done = ts;
+  uint64 end = address + size;
+
+  if (_completed == 0) _first_arrival = ts;
+
+  // transfers of this and later requests are not ready before ts
+  while (!_interface.empty() && (_interface.begin()->second <= ts))
+    _interface.erase(_interface.begin());
+
+  // split the request at actuator boundaries; every part is queued at its
+  // actuator and the parts are served in parallel
+  for (uint32 i = 0; (i < _actuators.size()) && (address < end); i++) {
+    if (address >= _first[i+1]) continue;
+
+    uint64 part = min(end, _first[i+1]) - address;
+    uint64 local = address - _first[i];
+    simtime start, finish;
+
+    if (write) {
+      // data crosses the interface before it is written to the media
+      start  = max(transfer(ts, part), _busy[i]);
+      finish = _actuators[i]->write(start, local, part);
+    } else {
+      start  = max(ts, _busy[i]);
+      finish = transfer(_actuators[i]->read(start, local, part), part);
+    }
+
+    _busy_time[i] += finish - start;
+    _busy[i] = finish;
+    _requests[i]++;
+    done = max(done, finish);
+    address += part;
+  }
+
+  _completed++;
+  _last_completion = max(_last_completion, done);
+  _latency.add(done - ts);
+
+  return done;
+}
+
+simtime MultiActuatorHDD::transfer(simtime ts, uint64 size)
+{
+  if (_interface_bandwidth <= 0.0)
+    return ts;
+
+  simtime length = to_simtime((double)size / _interface_bandwidth);
+  simtime start = ts;
+
+  // skip the reservations that overlap [start, start + length)
+  map<simtime, simtime>::iterator it = _interface.upper_bound(ts);
+  if (it != _interface.begin()) {
+    map<simtime, simtime>::iterator prev = it;
+    prev--;
+    start = max(start, prev->second);
+  }
+  while ((it != _interface.end()) && (it->first < start + length)) {
+    start = max(start, it->second);
+    it++;
+  }
+
+  if (length == 0)
+    return start;
+
+  // merge with adjacent reservations to keep the map small
+  simtime end = start + length;
+  if ((it != _interface.end()) && (it->first == end)) {
+    end = it->second;
+    it = _interface.erase(it);
+  }
+  if ((it != _interface.begin()) && ((--it)->second == start))
+    it->second = end;
+  else
+    _interface[start] = end;
+
+  return start + length;
+}
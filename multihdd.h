@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+/// @brief multi-actuator rotating disks
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_MULTIHDD_H__
+#define __CA_MULTIHDD_H__
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "disk.h"
+#include "hdd.h"
+#include "stats.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief multi-actuator rotating disks
+///
+/// MultiActuatorHDD implements drives whose platters are split between
+/// several independently moving head stacks (actuators). Each actuator is
+/// modeled by an HDD owning a contiguous part of the LBA range and has its
+/// own head position and request queue, so actuators serve requests in
+/// parallel. Data of all actuators passes through a single host interface,
+/// which is the only shared resource. The interface is work-conserving: a
+/// transfer occupies the first idle period after it is ready that is long
+/// enough, even if transfers reserved earlier (in call order) end later.
+/// Requests must arrive in time order.
+///
+class MultiActuatorHDD : public Disk {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor. The drive takes ownership of the actuators.
+    /// @param actuators one HDD per actuator; actuator i owns the LBA range
+    ///        following that of actuator i-1
+    /// @param interface_bandwidth transfer rate of the host interface
+    ///        (bytes/second), 0 for an interface that never limits
+    /// @param verbose toggle verbose output
+    MultiActuatorHDD(const vector<HDD*> &actuators, double interface_bandwidth,
+                     bool verbose=false);
+
+    /// @brief destructor
+    virtual ~MultiActuatorHDD(void);
+
+    /// @brief copy of the drive and all of its actuators
+    virtual Disk* clone(void) const;
+
+    /// @}
+
+
+    /// @name access methods
+    /// @{
+
+    /// @brief read @a size bytes from @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to read
+    /// @param size number of bytes to read
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
+
+    /// @brief write @a size bytes to @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to write
+    /// @param size number of bytes to write
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief completed requests per second of simulated time
+    double iops(void) const;
+
+    /// @brief print per-actuator and latency statistics
+    /// @param os output stream
+    void print_stats(ostream &os);
+
+    /// @brief discard the statistics collected so far (including those
+    ///        of the actuators)
+    virtual void reset_stats(void);
+
+    /// @brief keep latency distributions (including those of the actuators)
+    ///        in sketches of relative accuracy @a alpha
+    virtual void set_accuracy(double alpha);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the queue state, statistics and all actuators to a
+    ///        checkpoint
+    virtual bool save(ostream &os);
+
+    /// @brief restore the state written by save()
+    virtual bool load(istream &is);
+
+    /// @}
+
+
+  protected:
+    vector<HDD*> _actuators;        ///< actuators
+    vector<uint64> _first;          ///< first byte address of each actuator
+    vector<simtime> _busy;          ///< time at which each actuator is idle
+    vector<simtime> _busy_time;     ///< accumulated service time per actuator
+    vector<uint64> _requests;       ///< requests served per actuator
+    double _interface_bandwidth;    ///< host interface rate (bytes/second)
+    map<simtime, simtime> _interface; ///< transfers reserved on the host
+                                    ///< interface (start -> end), disjoint
+    bool   _verbose;                ///< toggle verbose output
+
+    simtime _first_arrival;         ///< arrival time of the first request
+    simtime _last_completion;       ///< completion time of the last request
+    uint64 _completed;              ///< number of requests
+    LatencyStats _latency;          ///< request latencies
+
+
+    /// @brief serve a read or write request
+    simtime access(simtime ts, uint64 address, uint64 size, bool write);
+
+    /// @brief occupy the host interface with a transfer of @a size bytes in
+    ///        its first idle period at or after @a ts that fits the transfer
+    /// @param ts earliest start time of the transfer
+    /// @param size number of bytes
+    /// @retval time when the transfer ends
+    simtime transfer(simtime ts, uint64 size);
+};
+
+#endif // __CA_MULTIHDD_H__
@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+/// @brief mergeable quantile sketch
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "quantile_sketch.h"
+#include "checkpoint.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// QuantileSketch
+//
+QuantileSketch::QuantileSketch(double alpha)
+  : _alpha(alpha)
+{
+  if (!(_alpha > 0.0) || !(_alpha < 1.0)) {
+    cout << "Error: accuracy of quantile sketch must be in (0, 1)" << endl;
+    _alpha = 0.01;
+  }
+  _log_gamma = log((1.0 + _alpha) / (1.0 - _alpha));
+
+  reset();
+}
+
+void QuantileSketch::add(simtime value)
+{
+  if (value <= 0)
+    _zero++;
+  else
+    _bins[bin((int32)ceil(log((double)value) / _log_gamma))]++;
+
+  _count++;
+}
+
+bool QuantileSketch::merge(const QuantileSketch &other)
+{
+  if (fabs(other._alpha - _alpha) > 1e-12) {
+    cout << "Error: cannot merge quantile sketches of different accuracy" << endl;
+    return false;
+  }
+
+  for (uint64 i = 0; i < other._bins.size(); i++)
+    if (other._bins[i] > 0)
+      _bins[bin(other._offset + (int32)i)] += other._bins[i];
+
+  _zero += other._zero;
+  _count += other._count;
+
+  return true;
+}
+
+void QuantileSketch::reset(void)
+{
+  _count = _zero = 0;
+  _offset = 0;
+  _bins.clear();
+}
+
+simtime QuantileSketch::quantile(double q) const
+{
+  if (_count == 0)
+    return 0;
+
+  // nearest rank, as LatencyStats::percentile()
+  uint64 rank = q <= 0.0 ? 0 : (uint64)ceil(q * _count);
+  if (rank > 0) rank--;
+  if (rank >= _count) rank = _count - 1;
+
+  uint64 seen = _zero;
+  if (rank < seen)
+    return 0;
+
+  for (uint64 i = 0; i < _bins.size(); i++) {
+    seen += _bins[i];
+    if (rank < seen) {
+      // the midpoint (in relative terms) of (gamma^(i-1), gamma^i]
+      double gamma = exp(_log_gamma);
+      double value = 2.0 * exp((_offset + (int32)i) * _log_gamma) / (gamma + 1.0);
+      return (simtime)(value + 0.5);
+    }
+  }
+
+  return 0;
+}
+
+void QuantileSketch::save(ostream &os) const
+{
+  ckpt_put(os, _alpha);
+  ckpt_put(os, _count);
+  ckpt_put(os, _zero);
+  ckpt_put(os, _offset);
+  ckpt_put(os, _bins);
+}
+
+bool QuantileSketch::load(istream &is)
+{
+  if (!ckpt_get(is, _alpha) || !(_alpha > 0.0) || !(_alpha < 1.0))
+    return false;
+  _log_gamma = log((1.0 + _alpha) / (1.0 - _alpha));
+
+  return ckpt_get(is, _count) && ckpt_get(is, _zero) && ckpt_get(is, _offset) &&
+         ckpt_get(is, _bins);
+}
+
+uint64 QuantileSketch::bin(int32 index)
+{
+  if (_bins.empty()) {
+    _offset = index;
+    _bins.assign(1, 0);
+    return 0;
+  }
+
+  if (index < _offset) {
+    // the lowest bin absorbs values below the capped range
+    uint64 grow = _offset - index;
+    if (_bins.size() + grow > QUANTILE_SKETCH_MAX_BINS)
+      return 0;
+
+    _bins.insert(_bins.begin(), grow, 0);
+    _offset = index;
+    return 0;
+  }
+
+  uint64 pos = index - _offset;
+  if (pos >= _bins.size()) {
+    if (pos >= QUANTILE_SKETCH_MAX_BINS) {
+      // collapse the lowest bins into the lowest remaining one
+      uint64 shift = pos - QUANTILE_SKETCH_MAX_BINS + 1;
+      uint64 collapsed = 0;
+
+      for (uint64 i = 0; (i < shift) && (i < _bins.size()); i++)
+        collapsed += _bins[i];
+      _bins.erase(_bins.begin(), _bins.begin() + min(shift, (uint64)_bins.size()));
+      _bins.resize(QUANTILE_SKETCH_MAX_BINS, 0);
+      _bins[0] += collapsed;
+      _offset += (int32)shift;
+      pos -= shift;
+    } else {
+      _bins.resize(pos + 1, 0);
+    }
+  }
+
+  return pos;
+}
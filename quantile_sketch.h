@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+/// @brief mergeable quantile sketch
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_QUANTILE_SKETCH_H__
+#define __CA_QUANTILE_SKETCH_H__
+
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+using namespace std;
+
+// largest number of bins; beyond, the lowest bins are collapsed
+#define QUANTILE_SKETCH_MAX_BINS  4096
+
+//------------------------------------------------------------------------------
+/// @brief mergeable quantile sketch with relative accuracy (DDSketch)
+///
+/// QuantileSketch counts values in logarithmically spaced bins: with
+/// gamma = (1 + alpha) / (1 - alpha), bin i holds the values in
+/// (gamma^(i-1), gamma^i]. Any quantile is reported with a relative error
+/// of at most alpha. An update costs O(1); the number of bins grows with
+/// the logarithm of the value range only (about 1000 bins for nanosecond
+/// latencies up to an hour at alpha = 0.01) and is capped at
+/// QUANTILE_SKETCH_MAX_BINS by collapsing the lowest bins, which affects
+/// only the lowest quantiles. Sketches of the same accuracy merge exactly
+/// by adding their bins, so sketches of several threads or runs combine
+/// into the sketch of all values.
+///
+class QuantileSketch {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param alpha relative accuracy in (0, 1)
+    QuantileSketch(double alpha=0.01);
+
+    /// @brief destructor
+    ~QuantileSketch(void) {};
+
+    /// @}
+
+
+    /// @name accumulation
+    /// @{
+
+    /// @brief add a value (values <= 0 are counted as zero)
+    void   add(simtime value);
+
+    /// @brief add the values of @a other
+    /// @retval true on success, false if the accuracies differ
+    bool   merge(const QuantileSketch &other);
+
+    /// @brief discard all values
+    void   reset(void);
+
+    /// @}
+
+
+    /// @name queries
+    /// @{
+
+    /// @brief relative accuracy
+    double accuracy(void) const { return _alpha; };
+
+    /// @brief number of values
+    uint64 count(void) const { return _count; };
+
+    /// @brief value at quantile @a q
+    /// @param q quantile in [0, 1]
+    /// @retval value below which a fraction @a q of the values lie (within
+    ///         the relative accuracy)
+    simtime quantile(double q) const;
+
+    /// @}
+
+
+    /// @name serialization
+    /// @{
+
+    /// @brief write the sketch to a binary stream
+    void   save(ostream &os) const;
+
+    /// @brief read a sketch written by save()
+    /// @retval true on success, false otherwise
+    bool   load(istream &is);
+
+    /// @}
+
+
+  protected:
+    double _alpha;                  ///< relative accuracy
+    double _log_gamma;              ///< ln(gamma)
+    uint64 _count;                  ///< number of values
+    uint64 _zero;                   ///< number of values <= 0
+    int32  _offset;                 ///< index of the bin in _bins[0]
+    vector<uint64> _bins;           ///< counts of the bins _offset, ...
+
+
+    /// @brief make room for bin @a index
+    /// @retval position of the bin in _bins
+    uint64 bin(int32 index);
+};
+
+#endif // __CA_QUANTILE_SKETCH_H__
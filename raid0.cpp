@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+/// @brief striped disk array (RAID-0)
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include "checkpoint.h"
+#include "raid0.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// RAID0
+//
+RAID0::RAID0(const vector<Disk*> &members, uint64 stripe_size,
+             bool parallel, bool verbose)
+  : _members(members), _stripe_size(stripe_size), _parallel(parallel),
+    _verbose(verbose), _workers(NULL)
+{
+  if (_stripe_size == 0) {
+    cout << "Error: RAID-0 stripe size must be positive" << endl;
+    _stripe_size = 4096;
+  }
+
+  _requests.assign(_members.size(), 0);
+  _parts.resize(_members.size());
+  _first.resize(_members.size());
+  _length.resize(_members.size());
+
+  //
+  // print info
+  //
+  cout.precision(6);
+  cout << "RAID-0: " << endl
+       << "  members:                   " << _members.size() << endl
+       << "  stripe size:               " << _stripe_size << endl
+       << "  parallel simulation:       " << (_parallel ? "yes" : "no") << endl
+       << endl;
+}
+
+RAID0::~RAID0(void)
+{
+  if (_workers != NULL) {
+    _workers->stop = true;
+    _workers->start.wait();
+    for (uint32 m = 0; m < _workers->threads.size(); m++)
+      _workers->threads[m].join();
+    delete _workers;
+  }
+
+  for (uint32 m = 0; m < _members.size(); m++)
+    delete _members[m];
+}
+
+Disk* RAID0::clone(void) const
+{
+  vector<Disk*> members;
+
+  for (uint32 m = 0; m < _members.size(); m++) {
+    members.push_back(_members[m]->clone());
+    if (members.back() == NULL) {
+      for (uint32 k = 0; k < members.size(); k++) delete members[k];
+      return NULL;
+    }
+  }
+
+  RAID0 *r = new RAID0(*this);
+  r->_members = members;
+  r->_workers = NULL;
+
+  return r;
+}
+
+simtime RAID0::read(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "RAID0::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, false);
+}
+
+simtime RAID0::write(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "RAID0::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return access(ts, address, size, true);
+}
+
+void RAID0::print_stats(ostream &os)
+{
+  os.precision(3);
+  os << "RAID-0 statistics:" << endl;
+  for (uint32 m = 0; m < _members.size(); m++) {
+    os << "  member " << m << ":" << endl
+       << "    requests:     " << dec << _requests[m] << endl;
+  }
+  os << "  latency:" << endl;
+  _latency.print(os, "    ");
+  os << endl;
+}
+
+void RAID0::reset_stats(void)
+{
+  for (uint32 m = 0; m < _members.size(); m++) {
+    _requests[m] = 0;
+    _members[m]->reset_stats();
+  }
+  _latency.reset();
+}
+
+void RAID0::set_accuracy(double alpha)
+{
+  for (uint32 m = 0; m < _members.size(); m++)
+    _members[m]->set_accuracy(alpha);
+  _latency.set_accuracy(alpha);
+}
+
+bool RAID0::save(ostream &os)
+{
+  ckpt_put_tag(os, "RAID");
+  ckpt_put(os, (uint32)_members.size());
+  ckpt_put(os, _stripe_size);
+  ckpt_put(os, _requests);
+  _latency.save(os);
+
+  for (uint32 m = 0; m < _members.size(); m++)
+    if (!_members[m]->save(os)) return false;
+
+  return os.good();
+}
+
+bool RAID0::load(istream &is)
+{
+  if (!ckpt_get_tag(is, "RAID") ||
+      !ckpt_check(is, (uint32)_members.size(), "number of members") ||
+      !ckpt_check(is, _stripe_size, "stripe size"))
+    return false;
+
+  if (!ckpt_get(is, _requests) ||
+      !_latency.load(is) || (_requests.size() != _members.size())) {
+    cout << "Error: corrupt RAID-0 state in checkpoint" << endl;
+    return false;
+  }
+
+  for (uint32 m = 0; m < _members.size(); m++)
+    if (!_members[m]->load(is)) return false;
+
+  return true;
+}
+
+void RAID0::split(uint64 address, uint64 size)
+{
+  uint32 n = _members.size();
+  uint64 end = address + size;
+
+  for (uint32 m = 0; m < n; m++)
+    _length[m] = 0;
+
+  // the units a member receives are consecutive on the member, so its part
+  // of the request is a single range
+  while (address < end) {
+    uint64 unit = address / _stripe_size;
+    uint64 unit_end = min(end, (unit + 1) * _stripe_size);
+    uint32 m = unit % n;
+
+    if (_length[m] == 0)
+      _first[m] = (unit / n) * _stripe_size + address % _stripe_size;
+    _length[m] += unit_end - address;
+    address = unit_end;
+  }
+}
+
+simtime RAID0::access(simtime ts, uint64 address, uint64 size, bool write)
+{
+  simtime done = ts;
+
+  split(address, size);
+  for (uint32 m = 0; m < _members.size(); m++) {
+    if (_length[m] == 0)
+      continue;
+
+    simtime t = write ? _members[m]->write(ts, _first[m], _length[m])
+                      : _members[m]->read(ts, _first[m], _length[m]);
+    done = max(done, t);
+    _requests[m]++;
+  }
+
+  _latency.add(done - ts);
+
+  return done;
+}
+
+void RAID0::process(const DiskBatch &batch)
+{
+  uint32 n = _members.size();
+
+  if (!_parallel || _verbose || (n < 2)) {
+    Disk::process(batch);
+    return;
+  }
+
+  //
+  // fan-out: split the requests into one batch per member
+  //
+  for (uint32 m = 0; m < n; m++) {
+    RAID0_Part &p = _parts[m];
+    p.ts.clear(); p.op.clear(); p.address.clear(); p.size.clear();
+    p.parent.clear();
+  }
+
+  for (uint64 i = 0; i < batch.count; i++) {
+    char op = batch.op[i];
+    batch.done[i] = batch.ts[i];
+
+    if ((op != 'r') && (op != 'w'))
+      continue;
+
+    split(batch.address[i], batch.size[i]);
+    for (uint32 m = 0; m < n; m++) {
+      if (_length[m] == 0)
+        continue;
+
+      RAID0_Part &p = _parts[m];
+      p.ts.push_back(batch.ts[i]);
+      p.op.push_back(op);
+      p.address.push_back(_first[m]);
+      p.size.push_back(_length[m]);
+      p.parent.push_back(i);
+      _requests[m]++;
+    }
+  }
+
+  for (uint32 m = 0; m < n; m++)
+    _parts[m].done.resize(_parts[m].ts.size());
+
+  //
+  // simulate the members concurrently
+  //
+  if (_workers == NULL) {
+    _workers = new RAID0_Workers(n);
+    for (uint32 m = 0; m < n; m++)
+      _workers->threads.push_back(thread(&RAID0::simulate_member, this, m));
+  }
+
+  _workers->start.wait();
+  _workers->done.wait();
+
+  //
+  // fan-in: a request completes with its last sub-request
+  //
+  for (uint32 m = 0; m < n; m++) {
+    RAID0_Part &p = _parts[m];
+    for (uint64 k = 0; k < p.parent.size(); k++)
+      batch.done[p.parent[k]] = max(batch.done[p.parent[k]], p.done[k]);
+  }
+
+  for (uint64 i = 0; i < batch.count; i++)
+    if ((batch.op[i] == 'r') || (batch.op[i] == 'w'))
+      _latency.add(batch.done[i] - batch.ts[i]);
+}
+
+void RAID0::simulate_member(uint32 member)
+{
+  RAID0_Part &p = _parts[member];
+
+  while (true) {
+    _workers->start.wait();
+    if (_workers->stop)
+      break;
+
+    if (!p.ts.empty()) {
+      DiskBatch b;
+      b.count = p.ts.size();
+      b.ts = &p.ts[0];
+      b.op = &p.op[0];
+      b.address = &p.address[0];
+      b.size = &p.size[0];
+      b.done = &p.done[0];
+      _members[member]->process(b);
+    }
+
+    _workers->done.wait();
+  }
+}
@@ -0,0 +1,185 @@
+//------------------------------------------------------------------------------
+/// @brief striped disk array (RAID-0)
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_RAID0_H__
+#define __CA_RAID0_H__
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "barrier.h"
+#include "disk.h"
+#include "stats.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief striped disk array (RAID-0)
+///
+/// RAID0 distributes the address space over its member devices in stripe
+/// units of a fixed size, round-robin. A request is split into at most one
+/// contiguous sub-request per member. All sub-requests arrive at the time of
+/// the request, and the request completes when the last one completes.
+///
+/// The members interact only through this fan-out and fan-in. The batch
+/// interface can therefore simulate them in parallel on one persistent thread
+/// per member: the calling thread splits the requests of a batch, the members
+/// then simulate all of their sub-requests concurrently, and after they have
+/// finished the calling thread combines the completion times. Every member
+/// sees its sub-requests in trace order, so the results are identical to the
+/// sequential engine.
+///
+class RAID0 : public Disk {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor. The array takes ownership of the members.
+    /// @param members member devices
+    /// @param stripe_size stripe unit (bytes)
+    /// @param parallel simulate the members of a batch on separate threads
+    /// @param verbose toggle verbose output
+    RAID0(const vector<Disk*> &members, uint64 stripe_size,
+          bool parallel=false, bool verbose=false);
+
+    /// @brief destructor
+    virtual ~RAID0(void);
+
+    /// @brief copy of the array and all of its members
+    virtual Disk* clone(void) const;
+
+    /// @}
+
+
+    /// @name access methods
+    /// @{
+
+    /// @brief read @a size bytes from @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to read
+    /// @param size number of bytes to read
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
+
+    /// @brief write @a size bytes to @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to write
+    /// @param size number of bytes to write
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @brief process a batch of requests in order; in parallel mode, the
+    ///        members run on separate threads
+    /// @param batch requests; completion times are stored in batch.done
+    virtual void process(const DiskBatch &batch);
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief print per-member and latency statistics
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @brief discard the statistics collected so far (including those
+    ///        of the members)
+    virtual void reset_stats(void);
+
+    /// @brief keep latency distributions (including those of the members)
+    ///        in sketches of relative accuracy @a alpha
+    virtual void set_accuracy(double alpha);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write the statistics and all members to a checkpoint
+    virtual bool save(ostream &os);
+
+    /// @brief restore the state written by save()
+    virtual bool load(istream &is);
+
+    /// @}
+
+
+  protected:
+    ///@brief sub-requests of a batch on one member (struct of arrays)
+    typedef struct _raid0_part {
+      vector<simtime> ts;           ///< arrival times
+      vector<char>   op;            ///< operations
+      vector<uint64> address;       ///< member addresses
+      vector<uint64> size;          ///< sizes
+      vector<simtime> done;         ///< completion times
+      vector<uint64> parent;        ///< index of the request in the batch
+    } RAID0_Part;
+
+    ///@brief member threads of the parallel batch simulation
+    typedef struct _raid0_workers {
+      Barrier start;                ///< released when a batch is split
+      Barrier done;                 ///< released when all members finished
+      vector<thread> threads;       ///< one thread per member
+      bool   stop;                  ///< tells the threads to exit
+
+      _raid0_workers(uint32 members)
+        : start(members + 1), done(members + 1), stop(false) {};
+    } RAID0_Workers;
+
+    vector<Disk*> _members;         ///< member devices
+    uint64 _stripe_size;            ///< stripe unit (bytes)
+    bool   _parallel;               ///< toggle parallel batch simulation
+    bool   _verbose;                ///< toggle verbose output
+    vector<uint64> _requests;       ///< sub-requests per member
+    LatencyStats _latency;          ///< latencies of all requests
+    vector<RAID0_Part> _parts;      ///< per-member sub-requests of a batch
+    vector<uint64> _first;          ///< scratch: first address per member
+    vector<uint64> _length;         ///< scratch: bytes per member
+    RAID0_Workers *_workers;        ///< member threads (started by the first
+                                    ///< parallel batch, not shared by clones)
+
+
+    /// @brief split a request into one contiguous range per member; the
+    ///        results are stored in _first and _length
+    void   split(uint64 address, uint64 size);
+
+    /// @brief serve a read or write request
+    simtime access(simtime ts, uint64 address, uint64 size, bool write);
+
+    /// @brief thread of @a member: simulate the sub-requests of each batch
+    ///        between the start and done barriers until stopped
+    void   simulate_member(uint32 member);
+};
+
+#endif // __CA_RAID0_H__
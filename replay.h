@@ -0,0 +1,641 @@
+//------------------------------------------------------------------------------
+/// @brief trace replay engine
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#ifndef __CA_REPLAY_H__
+#define __CA_REPLAY_H__
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "checkpoint.h"
+#include "disk.h"
+#include "spsc.h"
+#include "stats.h"
+#include "time_series.h"
+#include "trace_sketch.h"
+#include "trace_source.h"
+using namespace std;
+
+// number of requests read from the trace and simulated at once
+#define REPLAY_BATCH_SIZE  1024
+
+// number of batches in flight between the stages of a pipelined replay
+#define REPLAY_PIPELINE_DEPTH  8
+
+//------------------------------------------------------------------------------
+/// @brief print a request of a trace without its completion time
+/// @param os output stream
+/// @param t timestamp of the request
+/// @param rw operation ('r'/'w')
+/// @param address starting address (in bytes)
+/// @param length number of bytes
+/// @param flush flush @a os so that the request precedes the device's
+///        verbose output
+inline void print_request(ostream &os, simtime t, char rw, uint64 address, uint64 length,
+                          bool flush=true)
+{
+  os.precision(6);
+  switch (rw) {
+    case 'r': os << "read"; break;
+    case 'w': os << "write"; break;
+    default : os << "error in input trace";
+  }
+
+  os << "(" << to_seconds(t) << ", " << address << ", " << length << ") = ";
+  if (flush) os.flush();
+}
+
+///@brief requests of a batch and the storage behind its DiskBatch
+typedef struct _replay_batch {
+  vector<simtime> ts;               ///< timestamps
+  vector<char>   op;                ///< operations
+  vector<uint64> address;           ///< addresses
+  vector<uint64> size;              ///< sizes
+  vector<simtime> done;             ///< completion times
+  vector<uint32> stream;            ///< source streams (of a TraceSource)
+  uint64 first;                     ///< first request after the warm-up
+  int64  offset;                    ///< trace offset after the batch (-1 if
+                                    ///< unknown or not needed)
+  DiskBatch batch;                  ///< view of the arrays above
+} ReplayBatch;
+
+//------------------------------------------------------------------------------
+/// @brief trace replay engine
+///
+/// Replay reads requests ("<time> <r|w> <address> <length>") from a stream,
+/// simulates them in batches on a device of type @a D and prints every
+/// request with its completion time. The engine is instantiated per concrete
+/// device type: the device is called without virtual dispatch so that the
+/// compiler can inline its access path into the replay loop. Replay<Disk>
+/// serves dynamically composed devices through the virtual interface.
+///
+/// A pipelined replay parses, simulates and prints on three threads that
+/// pass batches through single-producer/single-consumer queues. Batches are
+/// recycled through a third queue, so the parser stalls once
+/// REPLAY_PIPELINE_DEPTH batches are in flight. Every stage handles the
+/// batches in trace order and the output is identical to a serial replay.
+///
+/// With checkpoints enabled, the state of the device is written to
+/// "<prefix>.<n>" after the first batch that reaches each multiple of the
+/// checkpoint interval (simulated time). A checkpoint records the offset of
+/// the next request in the trace, so a replay restored from it continues
+/// with identical results; the trace must be a seekable file.
+///
+/// A replay can be limited to the requests of a time window. Requests of the
+/// warm-up period before the window are simulated but neither printed nor
+/// counted: the statistics of the device are reset when the first request
+/// of the window is simulated.
+///
+/// Instead of parsing a stream, a replay can take its requests from a
+/// TraceSource. If the source delivers several streams (e.g., merged
+/// traces), every request is printed with its stream and the latencies are
+/// also reported per stream.
+///
+template <class D>
+class Replay {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param device device to simulate (not owned)
+    /// @param verbose toggle verbose output (simulates one request at a time)
+    /// @param pipeline parse, simulate and print on separate threads (ignored
+    ///        in verbose mode)
+    Replay(D *device, bool verbose=false, bool pipeline=false);
+
+    /// @brief destructor
+    ~Replay(void) {};
+
+    /// @}
+
+
+    /// @name replay
+    /// @{
+
+    /// @brief replay all requests of a trace
+    /// @param in trace
+    /// @param out output stream for the results
+    /// @retval number of requests
+    uint64 run(istream &in, ostream &out);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write checkpoints during the replay
+    /// @param prefix prefix of the checkpoint files
+    /// @param interval simulated time between checkpoints
+    void   set_checkpoints(const char *prefix, simtime interval);
+
+    /// @brief restore the device from a checkpoint and position the trace at
+    ///        the first request after it
+    /// @param filename checkpoint file
+    /// @param in trace (must be seekable)
+    /// @retval true on success, false otherwise
+    bool   restore(const char *filename, istream &in);
+
+    /// @}
+
+
+    /// @name trace sources
+    /// @{
+
+    /// @brief take the requests from @a source instead of the input stream
+    /// @param source source of the requests (not owned)
+    void   set_source(TraceSource *source);
+
+    /// @brief print the latencies of every stream of the source
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @brief keep the latencies of every stream in sketches of relative
+    ///        accuracy @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha);
+
+    /// @brief summarize the counted requests in @a sketch
+    /// @param sketch summary (not owned, or NULL)
+    void   set_sketch(TraceSketch *sketch) { _sketch = sketch; };
+
+    /// @brief aggregate the counted requests in @a series
+    /// @param series time series (not owned, or NULL)
+    void   set_series(TimeSeries *series) { _series = series; };
+
+    /// @}
+
+
+    /// @name time window
+    /// @{
+
+    /// @brief replay only the requests in [@a start, @a end), preceded by a
+    ///        warm-up of the requests in [@a start - @a warmup, @a start).
+    ///        Earlier requests are skipped, so the trace may be positioned
+    ///        anywhere before the warm-up period.
+    void   set_window(simtime start, simtime end, simtime warmup);
+
+    /// @}
+
+
+  protected:
+    D     *_device;                 ///< simulated device
+    bool   _verbose;                ///< toggle verbose output
+    bool   _pipeline;               ///< toggle pipelined replay
+    uint64 _batch_size;             ///< requests per batch
+    vector<ReplayBatch> _batches;   ///< batches (one unless pipelined)
+    string _ckpt_prefix;            ///< prefix of the checkpoint files
+    simtime _ckpt_interval;         ///< time between checkpoints (0=off)
+    simtime _ckpt_next;             ///< time of the next checkpoint (-1 until
+                                    ///< the first request)
+    uint64 _ckpt_count;             ///< number of checkpoints written
+    uint64 _simulated;              ///< requests simulated, including those
+                                    ///< before a restored checkpoint
+    string _ckpt_error;             ///< checkpointing error, reported once the
+                                    ///< replay is done; stops checkpointing
+                                    ///< (simulation thread only)
+    TraceSource *_source;           ///< source of requests (or NULL)
+    vector<LatencyStats> _stream_latency; ///< latencies per stream (if the
+                                    ///< source has several streams)
+    double _accuracy;               ///< accuracy of the stream latencies
+    TraceSketch *_sketch;           ///< summary of the requests (or NULL)
+    TimeSeries *_series;            ///< metrics per interval (or NULL)
+    simtime _warmup_start;          ///< first simulated timestamp
+    simtime _window_start;          ///< first printed and counted timestamp
+    simtime _window_end;            ///< end of the window (exclusive)
+    bool   _window_done;            ///< true once the parser passed the window
+    bool   _measuring;              ///< true once the statistics were reset
+                                    ///< at the end of the warm-up
+
+
+    /// @brief replay on the calling thread
+    uint64 run_serial(istream &in, ostream &out);
+
+    /// @brief replay on a parser, a simulation and a writer thread
+    uint64 run_pipelined(istream &in, ostream &out);
+
+    /// @brief read up to _batch_size requests into @a b
+    /// @retval number of requests read (0 at the end of the trace)
+    uint64 parse(istream &in, ReplayBatch &b);
+
+    /// @brief simulate the requests of @a b on the device
+    void   simulate(ReplayBatch &b);
+
+    /// @brief simulate the requests of @a batch on the device
+    void   process(const DiskBatch &batch);
+
+    /// @brief write a checkpoint if @a b (simulated last) reaches the time
+    ///        of the next one. Runs on the simulation thread.
+    void   checkpoint(const ReplayBatch &b);
+
+    /// @brief print the requests of @a b with their completion times
+    /// @param request true to print the requests, false to print only the
+    ///        completion times
+    void   print(ostream &out, const ReplayBatch &b, bool request);
+};
+
+
+//------------------------------------------------------------------------------
+// Replay
+//
+template <class D>
+Replay<D>::Replay(D *device, bool verbose, bool pipeline)
+  : _device(device), _verbose(verbose), _pipeline(pipeline && !verbose),
+    _ckpt_interval(0), _ckpt_next(-1), _ckpt_count(0), _simulated(0),
+    _source(NULL), _accuracy(0.0), _sketch(NULL), _series(NULL),
+    _warmup_start(numeric_limits<simtime>::min()),
+    _window_start(numeric_limits<simtime>::min()),
+    _window_end(numeric_limits<simtime>::max()),
+    _window_done(false), _measuring(true)
+{
+  _batch_size = _verbose ? 1 : REPLAY_BATCH_SIZE;
+  _batches.resize(_pipeline ? REPLAY_PIPELINE_DEPTH : 1);
+
+  for (uint32 i = 0; i < _batches.size(); i++) {
+    ReplayBatch &b = _batches[i];
+
+    b.ts.resize(_batch_size);
+    b.op.resize(_batch_size);
+    b.address.resize(_batch_size);
+    b.size.resize(_batch_size);
+    b.done.resize(_batch_size);
+    b.stream.resize(_batch_size);
+
+    b.batch.count = 0;
+    b.batch.ts = &b.ts[0];
+    b.batch.op = &b.op[0];
+    b.batch.address = &b.address[0];
+    b.batch.size = &b.size[0];
+    b.batch.done = &b.done[0];
+  }
+}
+
+template <class D>
+uint64 Replay<D>::run(istream &in, ostream &out)
+{
+  uint64 requests = _pipeline ? run_pipelined(in, out) : run_serial(in, out);
+
+  if (!_ckpt_error.empty())
+    out << "Error: " << _ckpt_error << endl;
+
+  return requests;
+}
+
+template <class D>
+void Replay<D>::set_checkpoints(const char *prefix, simtime interval)
+{
+  _ckpt_prefix = prefix;
+  _ckpt_interval = interval > 0 ? interval : 0;
+}
+
+template <class D>
+void Replay<D>::set_source(TraceSource *source)
+{
+  _source = source;
+  _stream_latency.clear();
+  if ((_source != NULL) && (_source->streams() > 1))
+    _stream_latency.resize(_source->streams(), LatencyStats(_accuracy));
+}
+
+template <class D>
+void Replay<D>::set_accuracy(double alpha)
+{
+  _accuracy = alpha;
+  for (uint32 s = 0; s < _stream_latency.size(); s++)
+    _stream_latency[s].set_accuracy(alpha);
+}
+
+template <class D>
+void Replay<D>::print_stats(ostream &os)
+{
+  LatencyStats total;
+
+  if (_stream_latency.empty())
+    return;
+
+  os.precision(6);
+  os << "Stream statistics:" << endl;
+  for (uint32 s = 0; s < _stream_latency.size(); s++) {
+    LatencyStats &l = _stream_latency[s];
+
+    os << "  stream " << s << " (" << _source->name(s) << "):" << endl
+       << "    requests:     " << dec << l.count() << endl
+       << "    mean latency: " << fixed << l.mean() << endl
+       << "    p99 latency:  " << fixed << to_seconds(l.percentile(99.0)) << endl
+       << "    max latency:  " << fixed << to_seconds(l.max()) << endl;
+    total.merge(l);
+  }
+
+  os << "  all streams:" << endl;
+  total.print(os, "    ");
+  os << endl;
+}
+
+template <class D>
+void Replay<D>::set_window(simtime start, simtime end, simtime warmup)
+{
+  _warmup_start = start - warmup;
+  _window_start = start;
+  _window_end = end;
+  _measuring = false;
+}
+
+template <class D>
+bool Replay<D>::restore(const char *filename, istream &in)
+{
+  ifstream f(filename, ios::binary);
+  char magic[4];
+  int64 offset;
+
+  if (!f.good()) {
+    cout << "Error: cannot open checkpoint '" << filename << "'" << endl;
+    return false;
+  }
+
+  f.read(magic, 4);
+  if (!f.good() || (memcmp(magic, CKPT_MAGIC, 4) != 0)) {
+    cout << "Error: '" << filename << "' is not a checkpoint" << endl;
+    return false;
+  }
+
+  if (!ckpt_check(f, (uint32)CKPT_VERSION, "format version"))
+    return false;
+
+  if (!ckpt_get(f, offset) || !ckpt_get(f, _simulated) ||
+      !ckpt_get(f, _ckpt_count) || !ckpt_get(f, _ckpt_next)) {
+    cout << "Error: truncated checkpoint '" << filename << "'" << endl;
+    return false;
+  }
+
+  if (!_device->load(f))
+    return false;
+
+  in.seekg(offset);
+  if (!in.good()) {
+    cout << "Error: cannot position the trace at offset " << offset
+         << " (the trace must be a file)" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+template <class D>
+uint64 Replay<D>::run_serial(istream &in, ostream &out)
+{
+  ReplayBatch &b = _batches[0];
+  uint64 requests = 0;
+
+  while (parse(in, b) > 0) {
+    // in verbose mode, the request is printed before the device's output
+    if (_verbose && (b.first == 0)) {
+      if (!_stream_latency.empty()) out << b.stream[0] << " ";
+      print_request(out, b.ts[0], b.op[0], b.address[0], b.size[0]);
+    }
+
+    simulate(b);
+    checkpoint(b);
+    print(out, b, !_verbose);
+
+    requests += b.batch.count;
+  }
+
+  return requests;
+}
+
+template <class D>
+uint64 Replay<D>::run_pipelined(istream &in, ostream &out)
+{
+  SPSCQueue<ReplayBatch*> empty(_batches.size());
+  SPSCQueue<ReplayBatch*> parsed(_batches.size());
+  SPSCQueue<ReplayBatch*> simulated(_batches.size());
+  uint64 requests = 0;
+
+  // a tied input stream flushes the output on every read, i.e., the parser
+  // would write to the writer's stream
+  ostream *tied = in.tie(NULL);
+
+  for (uint32 i = 0; i < _batches.size(); i++)
+    empty.put(&_batches[i]);
+
+  // an empty batch marks the end of the trace and passes through all stages
+  thread parser([&]() {
+    uint64 count;
+    do {
+      ReplayBatch *b = empty.get();
+      count = parse(in, *b);
+      parsed.put(b);
+    } while (count > 0);
+  });
+
+  thread writer([&]() {
+    ReplayBatch *b;
+    while ((b = simulated.get())->batch.count > 0) {
+      print(out, *b, true);
+      requests += b->batch.count;
+      empty.put(b);
+    }
+  });
+
+  // the writer recycles a batch as soon as it is put, so its count must be
+  // read before
+  uint64 count;
+  do {
+    ReplayBatch *b = parsed.get();
+    count = b->batch.count;
+    if (count > 0) {
+      simulate(*b);
+      checkpoint(*b);
+    }
+    simulated.put(b);
+  } while (count > 0);
+
+  parser.join();
+  writer.join();
+  in.tie(tied);
+
+  return requests;
+}
+
+template <class D>
+uint64 Replay<D>::parse(istream &in, ReplayBatch &b)
+{
+  b.batch.count = 0;
+  b.first = 0;
+
+  while ((b.batch.count < _batch_size) && !_window_done) {
+    uint64 i = b.batch.count;
+
+    if (_source != NULL) {
+      TraceRecord r;
+      if (!_source->next(r)) break;
+      b.ts[i] = r.ts;
+      b.op[i] = r.op;
+      b.address[i] = r.address;
+      b.size[i] = r.size;
+      b.stream[i] = r.stream;
+    } else {
+      double t;
+      in >> t >> b.op[i] >> b.address[i] >> b.size[i];
+      if (!in.good()) break;
+      b.ts[i] = to_simtime(t);
+    }
+
+    if (b.ts[i] < _warmup_start) continue;
+    if (b.ts[i] >= _window_end) {
+      _window_done = true;
+      break;
+    }
+    if ((b.first == i) && (b.ts[i] < _window_start)) b.first++;
+    b.batch.count++;
+  }
+
+  // the stream fails at the end of the trace; no checkpoint is needed there.
+  // Requests of a source have no offset in the input stream.
+  b.offset = ((_ckpt_interval > 0) && in.good() && !_window_done && (_source == NULL)) ?
+             (int64)in.tellg() : -1;
+
+  return b.batch.count;
+}
+
+template <class D>
+void Replay<D>::print(ostream &out, const ReplayBatch &b, bool request)
+{
+  for (uint64 i = b.first; i < b.batch.count; i++) {
+    if (!_stream_latency.empty()) {
+      if ((b.op[i] == 'r') || (b.op[i] == 'w'))
+        _stream_latency[b.stream[i]].add(b.done[i] - b.ts[i]);
+      if (request) out << b.stream[i] << " ";
+    }
+    if ((b.op[i] == 'r') || (b.op[i] == 'w')) {
+      if (_sketch != NULL) _sketch->add(b.address[i], b.done[i] - b.ts[i]);
+      if (_series != NULL) _series->add(b.ts[i], b.done[i], b.size[i]);
+    }
+    if (request) print_request(out, b.ts[i], b.op[i], b.address[i], b.size[i], false);
+    out.precision(6);
+    out << to_seconds(b.done[i]) << '\n';
+  }
+  out.flush();
+}
+
+template <class D>
+inline void Replay<D>::simulate(ReplayBatch &b)
+{
+  if (_measuring) {
+    process(b.batch);
+    return;
+  }
+
+  // the warm-up requests of the batch precede those of the window
+  DiskBatch part = b.batch;
+  part.count = b.first;
+  if (part.count > 0) process(part);
+
+  if (b.first < b.batch.count) {
+    _device->reset_stats();
+    _measuring = true;
+
+    part.count = b.batch.count - b.first;
+    part.ts += b.first;
+    part.op += b.first;
+    part.address += b.first;
+    part.size += b.first;
+    part.done += b.first;
+    process(part);
+  }
+}
+
+template <class D>
+inline void Replay<D>::process(const DiskBatch &batch)
+{
+  // qualified call: no virtual dispatch, inlinable for header-only devices
+  _device->D::process(batch);
+}
+
+template <>
+inline void Replay<Disk>::process(const DiskBatch &batch)
+{
+  _device->process(batch);
+}
+
+template <class D>
+void Replay<D>::checkpoint(const ReplayBatch &b)
+{
+  _simulated += b.batch.count;
+
+  // after an error, no further checkpoints are written. _ckpt_interval is
+  // read by the parser thread and must not change during the replay.
+  if ((_ckpt_interval == 0) || !_ckpt_error.empty() || (b.batch.count == 0))
+    return;
+
+  simtime last = b.ts[b.batch.count-1];
+
+  if (_ckpt_next < 0) _ckpt_next = b.ts[0] + _ckpt_interval;
+  if (last < _ckpt_next) return;
+
+  // the last batch of a trace is partial and needs no checkpoint; a full
+  // batch without an offset comes from a stream without positions
+  if (b.offset < 0) {
+    if (b.batch.count == _batch_size) {
+      _ckpt_error = "cannot checkpoint a trace that is not a file";
+    }
+    return;
+  }
+
+  while (_ckpt_next <= last) _ckpt_next += _ckpt_interval;
+
+  ostringstream name;
+  name << _ckpt_prefix << "." << _ckpt_count;
+
+  ofstream f(name.str().c_str(), ios::binary);
+  f.write(CKPT_MAGIC, 4);
+  ckpt_put(f, (uint32)CKPT_VERSION);
+  ckpt_put(f, b.offset);
+  ckpt_put(f, _simulated);
+  ckpt_put(f, _ckpt_count + 1);
+  ckpt_put(f, _ckpt_next);
+
+  if (!_device->save(f) || !f.good()) {
+    _ckpt_error = "cannot write checkpoint '" + name.str() + "'";
+    return;
+  }
+
+  _ckpt_count++;
+}
+
+#endif // __CA_REPLAY_H__
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+/// @brief accuracy of spatially sampled replays
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include "sampling_report.h"
+#include "trace_sample.h"
+#include "hybrid.h"
+#include "stats.h"
+using namespace std;
+
+
+/// @brief relative deviation of @a sampled from @a full
+static double deviation(double sampled, double full)
+{
+  if (full == 0.0) return sampled == 0.0 ? 0.0 : 1.0;
+  return fabs(sampled - full) / full;
+}
+
+
+//------------------------------------------------------------------------------
+// SamplingReport
+//
+SamplingReport::SamplingReport(const Disk *device, uint32 block_size, uint32 threads)
+  : _device(device), _block_size(block_size > 0 ? block_size : 1), _threads(threads),
+    _accuracy(0.0)
+{
+  if (_threads == 0) _threads = thread::hardware_concurrency();
+  if (_threads == 0) _threads = 1;
+}
+
+uint64 SamplingReport::load(TraceSource *source)
+{
+  return _trace.load(source);
+}
+
+bool SamplingReport::run(double min_rate, double max_rate, uint32 points)
+{
+  vector<Disk*> devices;
+  atomic<uint32> next(0);
+  vector<thread> workers;
+
+  if (points == 0) points = 1;
+  _points.resize(points + 1);
+
+  // copy the devices up front: the workers never touch the original
+  _points[0].rate = 1.0;
+  for (uint32 i = 1; i <= points; i++) {
+    double step = points > 1 ? (double)(i - 1) / (points - 1) : 0.0;
+    _points[i].rate = min_rate * pow(max_rate / min_rate, step);
+  }
+
+  for (uint32 i = 0; i <= points; i++) {
+    devices.push_back(_device->clone());
+    if (devices.back() == NULL) {
+      cout << "Error: sampling reports are not supported on this device" << endl;
+      for (uint32 k = 0; k < devices.size(); k++) delete devices[k];
+      return false;
+    }
+  }
+
+  for (uint32 w = 0; w < min(_threads, points + 1); w++) {
+    workers.push_back(thread([&]() {
+      uint32 i;
+      while ((i = next.fetch_add(1)) <= points)
+        simulate(devices[i], _points[i]);
+    }));
+  }
+
+  for (uint32 w = 0; w < workers.size(); w++)
+    workers[w].join();
+  for (uint32 i = 0; i <= points; i++)
+    delete devices[i];
+
+  return true;
+}
+
+void SamplingReport::simulate(Disk *device, SamplePoint &p)
+{
+  LatencyStats latency(_accuracy);
+  uint64 threshold = SpatialSampler::threshold(p.rate);
+  vector<simtime> ts;
+  vector<char>   op;
+  vector<uint64> address, size;
+  double sum = 0.0;
+
+  // keep the runs of sampled blocks of every request (see SpatialSampler)
+  for (uint64 i = 0; i < _trace.count(); i++) {
+    uint64 a = _trace.address(i), end = a + _trace.size(i), n;
+
+    while (SpatialSampler::run(&a, &n, end, _block_size, threshold)) {
+      ts.push_back(SpatialSampler::scale(_trace.ts(i), _trace.ts(0), p.rate));
+      op.push_back(_trace.op(i));
+      address.push_back(a);
+      size.push_back(n);
+      if ((a += n) >= end) break;
+    }
+  }
+
+  vector<simtime> done(ts.size());
+  DiskBatch b = { ts.size(), ts.data(), op.data(), address.data(), size.data(), done.data() };
+
+  device->scale_capacity(p.rate);
+  device->process(b);
+
+  for (uint64 i = 0; i < b.count; i++) {
+    latency.add(done[i] - ts[i]);
+    sum += to_seconds(done[i] - ts[i]);
+  }
+
+  const HybridDisk *hybrid = dynamic_cast<const HybridDisk*>(device);
+
+  p.requests = b.count;
+  p.mean = b.count > 0 ? sum / b.count : 0.0;
+  p.p50 = latency.percentile(50.0);
+  p.p99 = latency.percentile(99.0);
+  p.hit_ratio = hybrid != NULL ? hybrid->hit_ratio() : -1.0;
+}
+
+void SamplingReport::print_stats(ostream &os)
+{
+  int best = -1;
+
+  if (_points.empty()) return;
+  const SamplePoint &full = _points[0];
+
+  os.precision(6);
+  os << "Sampling report:" << endl
+     << "  requests:                  " << dec << _trace.count() << endl
+     << "  block size:                " << _block_size << endl
+     << "  threads:                   " << _threads << endl
+     << "      rate  requests  mean latency   p50 latency   p99 latency  hit ratio"
+     << "  mean err.  p99 err.  hit err." << endl;
+
+  for (uint32 i = 0; i < _points.size(); i++) {
+    const SamplePoint &p = _points[i];
+    double mean_err = deviation(p.mean, full.mean);
+    double p99_err = deviation((double)p.p99, (double)full.p99);
+    double hit_err = p.hit_ratio >= 0.0 ? fabs(p.hit_ratio - full.hit_ratio) : 0.0;
+
+    if ((i > 0) && (mean_err <= SAMPLING_TOLERANCE) && (p99_err <= SAMPLING_TOLERANCE) &&
+        (hit_err <= SAMPLING_TOLERANCE) && ((best < 0) || (p.rate < _points[best].rate)))
+      best = i;
+
+    os << "  " << setw(8) << setprecision(4) << p.rate
+       << setw(10) << p.requests
+       << setw(14) << setprecision(6) << p.mean
+       << setw(14) << to_seconds(p.p50)
+       << setw(14) << to_seconds(p.p99);
+    if (p.hit_ratio >= 0.0)
+      os << setw(11) << setprecision(4) << p.hit_ratio;
+    else
+      os << setw(11) << "-";
+    if (i > 0) {
+      os << setw(10) << setprecision(1) << 100.0 * mean_err << "%"
+         << setw(9) << 100.0 * p99_err << "%";
+      if (p.hit_ratio >= 0.0)
+        os << setw(9) << setprecision(4) << hit_err;
+    }
+    os << endl;
+  }
+
+  if (best >= 0)
+    os << "  smallest acceptable rate:  " << setprecision(4) << _points[best].rate
+       << " (tolerance " << setprecision(2) << SAMPLING_TOLERANCE << ")" << endl;
+  else
+    os << "  smallest acceptable rate:  none within tolerance " << setprecision(2)
+       << SAMPLING_TOLERANCE << endl;
+  os << endl;
+}
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+/// @brief accuracy of spatially sampled replays
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_SAMPLING_REPORT_H__
+#define __CA_SAMPLING_REPORT_H__
+
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+#include "trace_memory.h"
+#include "trace_source.h"
+using namespace std;
+
+// a sampling rate is acceptable if the mean and 99th percentile latency
+// deviate by at most this fraction and the hit ratio by at most this
+// difference from the full replay
+#define SAMPLING_TOLERANCE  0.05
+
+///@brief result of the replay at one sampling rate
+typedef struct _sample_point {
+  double rate;                      ///< sampling rate (1: full trace)
+  uint64 requests;                  ///< sampled requests
+  double mean;                      ///< mean latency (seconds)
+  simtime p50;                      ///< median latency
+  simtime p99;                      ///< 99th percentile latency
+  double hit_ratio;                 ///< cache hit ratio (-1: no cache)
+} SamplePoint;
+
+//------------------------------------------------------------------------------
+/// @brief comparison of sampled and full replays
+///
+/// SamplingReport replays the requests of a trace in full and spatially
+/// sampled (see SpatialSampler) at a series of rates, each on its own copy
+/// of the device with the capacity-dependent parameters and the time since
+/// the first request scaled by the rate.
+/// The replays run in parallel on separate threads. The report lists the
+/// deviation of every sampled replay from the full one and the smallest
+/// rate whose results lie within SAMPLING_TOLERANCE.
+///
+class SamplingReport {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param device device in its initial state (not owned, not modified)
+    /// @param block_size sampling granularity (bytes)
+    /// @param threads number of threads (0: one per core)
+    SamplingReport(const Disk *device, uint32 block_size, uint32 threads=0);
+
+    /// @brief destructor
+    ~SamplingReport(void) {};
+
+    /// @}
+
+
+    /// @name simulation
+    /// @{
+
+    /// @brief read the requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief keep the latencies of a run in a sketch of relative accuracy
+    ///        @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha) { _accuracy = alpha; };
+
+    /// @brief replay the full trace and @a points rates spaced
+    ///        geometrically from @a min_rate to @a max_rate
+    /// @retval true on success, false if the device cannot be copied
+    bool   run(double min_rate, double max_rate, uint32 points);
+
+    /// @brief print the results and the smallest acceptable rate
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @}
+
+
+  protected:
+    const Disk *_device;            ///< initial device
+    uint32 _block_size;             ///< sampling granularity (bytes)
+    uint32 _threads;                ///< number of threads
+    double _accuracy;               ///< accuracy of the latencies of a run
+    MemoryTrace _trace;             ///< requests
+    vector<SamplePoint> _points;    ///< results; the full replay first
+
+
+    /// @brief replay the requests sampled at @a p.rate on @a device
+    void   simulate(Disk *device, SamplePoint &p);
+};
+
+#endif // __CA_SAMPLING_REPORT_H__
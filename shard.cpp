@@ -0,0 +1,345 @@
+//------------------------------------------------------------------------------
+/// @brief sharded trace replay on multiple devices
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include "shard.h"
+#include "replay.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// ShardedReplay
+//
+ShardedReplay::ShardedReplay(const vector<Disk*> &devices, uint32 workers)
+  : _devices(devices), _workers(workers), _done(false), _sketch(NULL), _invalid(0)
+{
+  uint32 n = _devices.size();
+
+  if (_workers == 0) _workers = thread::hardware_concurrency();
+  if (_workers > n) _workers = n;
+  if (_workers == 0) _workers = 1;
+
+  _scheduled = new atomic<bool>[n];
+  for (uint32 d = 0; d < n; d++) {
+    _scheduled[d].store(false);
+    // every chunk in flight queues at most one batch per device
+    _queued.push_back(new SPSCQueue<ShardPart*>(SHARD_DEPTH));
+  }
+
+  // every device is scheduled at most once, so no worker queue overflows
+  for (uint32 w = 0; w < _workers; w++)
+    _ready.push_back(new MPMCQueue<uint32>(n));
+
+  for (uint32 i = 0; i < SHARD_DEPTH; i++) {
+    ShardChunk *c = new ShardChunk;
+
+    c->count = 0;
+    c->ts.resize(SHARD_CHUNK_SIZE);
+    c->device.resize(SHARD_CHUNK_SIZE);
+    c->op.resize(SHARD_CHUNK_SIZE);
+    c->address.resize(SHARD_CHUNK_SIZE);
+    c->size.resize(SHARD_CHUNK_SIZE);
+    c->slot.resize(SHARD_CHUNK_SIZE);
+    c->part_ts.resize(SHARD_CHUNK_SIZE);
+    c->part_op.resize(SHARD_CHUNK_SIZE);
+    c->part_address.resize(SHARD_CHUNK_SIZE);
+    c->part_size.resize(SHARD_CHUNK_SIZE);
+    c->part_done.resize(SHARD_CHUNK_SIZE);
+    c->parts.reserve(n);   // parts are queued by address; never reallocate
+    c->pending.store(0);
+    _chunks.push_back(c);
+  }
+
+  _latency.resize(n);
+  _steals.assign(_workers, 0);
+  _first.resize(n + 1);
+  _fill.resize(n);
+}
+
+ShardedReplay::~ShardedReplay(void)
+{
+  for (uint32 d = 0; d < _queued.size(); d++)
+    delete _queued[d];
+  for (uint32 w = 0; w < _ready.size(); w++)
+    delete _ready[w];
+  for (uint32 i = 0; i < _chunks.size(); i++)
+    delete _chunks[i];
+  delete[] _scheduled;
+}
+
+uint64 ShardedReplay::run(istream &in, ostream &out)
+{
+  SPSCQueue<ShardChunk*> empty(SHARD_DEPTH);
+  SPSCQueue<ShardChunk*> filled(SHARD_DEPTH);
+  vector<thread> workers;
+  uint64 requests = 0;
+
+  // a tied input stream flushes the output on every read, i.e., the parser
+  // would write to the writer's stream
+  ostream *tied = in.tie(NULL);
+
+  for (uint32 i = 0; i < _chunks.size(); i++)
+    empty.put(_chunks[i]);
+
+  _done.store(false);
+  for (uint32 w = 0; w < _workers; w++)
+    workers.push_back(thread(&ShardedReplay::work, this, w));
+
+  // the writer prints the chunks in trace order; an empty chunk marks the end
+  // of the trace
+  thread writer([&]() {
+    ShardChunk *c;
+    while ((c = filled.get())->count > 0) {
+      for (uint32 spins = 0; c->pending.load(memory_order_acquire) > 0; spins++)
+        spin_wait(spins);
+      print(out, *c);
+      requests += c->count;
+      empty.put(c);
+    }
+  });
+
+  uint64 count;
+  do {
+    ShardChunk *c = empty.get();
+    count = parse(in, *c);
+    if (count > 0) dispatch(*c);
+    filled.put(c);
+  } while (count > 0);
+
+  writer.join();
+  _done.store(true, memory_order_release);
+  for (uint32 w = 0; w < _workers; w++)
+    workers[w].join();
+  in.tie(tied);
+
+  for (uint32 d = 0; d < _sketches.size(); d++)
+    _sketch->merge(_sketches[d]);
+
+  return requests;
+}
+
+uint64 ShardedReplay::parse(istream &in, ShardChunk &c)
+{
+  c.count = 0;
+
+  while ((c.count < SHARD_CHUNK_SIZE) && in.good()) {
+    uint64 i = c.count;
+    double t;
+    in >> t >> c.device[i] >> c.op[i] >> c.address[i] >> c.size[i];
+    if (!in.good()) break;
+    c.ts[i] = to_simtime(t);
+    c.count++;
+  }
+
+  return c.count;
+}
+
+void ShardedReplay::dispatch(ShardChunk &c)
+{
+  uint32 n = _devices.size();
+
+  // group the requests by device (counting sort, stable): the requests of a
+  // device form a contiguous batch in trace order
+  _first.assign(n + 1, 0);
+  for (uint64 i = 0; i < c.count; i++)
+    if (c.device[i] < n) _first[c.device[i] + 1]++;
+  for (uint32 d = 0; d < n; d++)
+    _first[d + 1] += _first[d];
+
+  for (uint32 d = 0; d < n; d++)
+    _fill[d] = _first[d];
+  for (uint64 i = 0; i < c.count; i++) {
+    uint32 d = c.device[i];
+    if (d >= n) {
+      _invalid++;
+      c.slot[i] = SHARD_CHUNK_SIZE;
+      continue;
+    }
+
+    uint64 s = _fill[d]++;
+    c.slot[i] = s;
+    c.part_ts[s] = c.ts[i];
+    c.part_op[s] = c.op[i];
+    c.part_address[s] = c.address[i];
+    c.part_size[s] = c.size[i];
+  }
+
+  c.parts.clear();
+  for (uint32 d = 0; d < n; d++) {
+    if (_first[d + 1] == _first[d])
+      continue;
+
+    ShardPart p;
+    uint64 s = _first[d];
+    p.chunk = &c;
+    p.device = d;
+    p.batch.count = _first[d + 1] - s;
+    p.batch.ts = &c.part_ts[s];
+    p.batch.op = &c.part_op[s];
+    p.batch.address = &c.part_address[s];
+    p.batch.size = &c.part_size[s];
+    p.batch.done = &c.part_done[s];
+    c.parts.push_back(p);
+  }
+
+  c.pending.store(c.parts.size(), memory_order_release);
+  for (uint32 i = 0; i < c.parts.size(); i++) {
+    uint32 d = c.parts[i].device;
+    _queued[d]->put(&c.parts[i]);
+    schedule(d, d % _workers);
+  }
+}
+
+void ShardedReplay::schedule(uint32 device, uint32 worker)
+{
+  // pairs with the fence in serve(): either the owner sees the new batch or
+  // we see that the device is no longer scheduled
+  atomic_thread_fence(memory_order_seq_cst);
+
+  if (!_scheduled[device].exchange(true))
+    for (uint32 spins = 0; !_ready[worker]->push(device); spins++)
+      spin_wait(spins);
+}
+
+void ShardedReplay::work(uint32 id)
+{
+  uint32 spins = 0;
+
+  while (1) {
+    uint32 device;
+    bool found = _ready[id]->pop(device);
+
+    // steal from the other workers
+    for (uint32 k = 1; !found && (k < _workers); k++) {
+      if (_ready[(id + k) % _workers]->pop(device)) {
+        found = true;
+        _steals[id]++;
+      }
+    }
+
+    if (found) {
+      serve(device, id);
+      spins = 0;
+    } else if (_done.load(memory_order_acquire)) {
+      break;
+    } else {
+      spin_wait(spins++);
+    }
+  }
+}
+
+void ShardedReplay::serve(uint32 device, uint32 worker)
+{
+  ShardPart *p;
+
+  for (uint32 n = 0; (n < SHARD_TURN) && _queued[device]->pop(p); n++) {
+    DiskBatch &b = p->batch;
+
+    _devices[device]->process(b);
+    for (uint64 i = 0; i < b.count; i++) {
+      if ((b.op[i] == 'r') || (b.op[i] == 'w')) {
+        _latency[device].add(b.done[i] - b.ts[i]);
+        if (_sketch != NULL) _sketches[device].add(b.address[i], b.done[i] - b.ts[i]);
+      }
+    }
+
+    p->chunk->pending.fetch_sub(1, memory_order_release);
+  }
+
+  // release the device and take it back if more batches have been queued
+  _scheduled[device].store(false);
+  atomic_thread_fence(memory_order_seq_cst);
+
+  if (!_queued[device]->empty())
+    schedule(device, worker);
+}
+
+void ShardedReplay::print(ostream &out, const ShardChunk &c)
+{
+  for (uint64 i = 0; i < c.count; i++) {
+    uint64 s = c.slot[i];
+    simtime done = s < SHARD_CHUNK_SIZE ? c.part_done[s] : c.ts[i];
+
+    out << c.device[i] << " ";
+    print_request(out, c.ts[i], c.op[i], c.address[i], c.size[i], false);
+    out.precision(6);
+    out << to_seconds(done) << '\n';
+  }
+  out.flush();
+}
+
+void ShardedReplay::set_sketch(TraceSketch *sketch)
+{
+  _sketch = sketch;
+  _sketches.clear();
+  if (_sketch != NULL)
+    _sketches.resize(_devices.size(), *_sketch);
+}
+
+void ShardedReplay::set_accuracy(double alpha)
+{
+  for (uint32 d = 0; d < _latency.size(); d++)
+    _latency[d].set_accuracy(alpha);
+}
+
+void ShardedReplay::print_stats(ostream &os)
+{
+  LatencyStats total;
+  uint64 steals = 0;
+
+  for (uint32 w = 0; w < _workers; w++)
+    steals += _steals[w];
+
+  os.precision(6);
+  os << "Sharded replay statistics:" << endl
+     << "  devices:                   " << dec << _devices.size() << endl
+     << "  workers:                   " << _workers << endl
+     << "  stolen devices:            " << steals << endl
+     << "  unknown device IDs:        " << _invalid << endl;
+
+  for (uint32 d = 0; d < _devices.size(); d++) {
+    if (_latency[d].count() == 0)
+      continue;
+
+    os << "  device " << d << ":" << endl
+       << "    requests:     " << _latency[d].count() << endl
+       << "    mean latency: " << fixed << _latency[d].mean() << endl
+       << "    p99 latency:  " << fixed << to_seconds(_latency[d].percentile(99.0)) << endl;
+    total.merge(_latency[d]);
+  }
+
+  os << "  all devices:" << endl;
+  total.print(os, "    ");
+  os << endl;
+}
@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+/// @brief sharded trace replay on multiple devices
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_SHARD_H__
+#define __CA_SHARD_H__
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+#include "mpmc.h"
+#include "spsc.h"
+#include "stats.h"
+#include "trace_sketch.h"
+using namespace std;
+
+// number of requests read from the trace and distributed at once
+#define SHARD_CHUNK_SIZE   4096
+
+// number of chunks in flight between the parser and the writer
+#define SHARD_DEPTH        8
+
+// number of request batches a worker simulates on a device before it gives
+// other devices a turn
+#define SHARD_TURN         4
+
+//------------------------------------------------------------------------------
+/// @brief trace replay on many independent devices
+///
+/// ShardedReplay reads requests ("<time> <device> <r|w> <address> <length>")
+/// and simulates each on its device. The calling thread parses the trace in
+/// chunks and splits every chunk into one batch per device. Each device
+/// queues its batches in a lock-free SPSC queue.
+///
+/// A device with queued batches is scheduled on a worker thread through that
+/// worker's lock-free MPMC queue. At any time at most one worker owns the
+/// device, so the device's requests are simulated in trace order. Idle
+/// workers steal devices from the queues of the other workers, so a hot
+/// device occupies one core but does not hold back the others. A writer
+/// thread prints the chunks in trace order once all their batches are done.
+///
+class ShardedReplay {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param devices devices, indexed by device ID (not owned)
+    /// @param workers number of worker threads (0: one per core)
+    ShardedReplay(const vector<Disk*> &devices, uint32 workers=0);
+
+    /// @brief destructor
+    ~ShardedReplay(void);
+
+    /// @}
+
+
+    /// @name replay
+    /// @{
+
+    /// @brief replay all requests of a trace
+    /// @param in trace
+    /// @param out output stream for the results
+    /// @retval number of requests
+    uint64 run(istream &in, ostream &out);
+
+    /// @brief print per-device and aggregate statistics
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @brief summarize the requests in @a sketch. Every device keeps its
+    ///        own summary, which is merged into @a sketch after the run.
+    /// @param sketch empty summary (not owned, or NULL)
+    void   set_sketch(TraceSketch *sketch);
+
+    /// @brief keep the latencies of every device in sketches of relative
+    ///        accuracy @a alpha (0: keep every latency)
+    void   set_accuracy(double alpha);
+
+    /// @}
+
+
+  protected:
+    struct _shard_chunk;
+
+    ///@brief requests of one chunk on one device
+    typedef struct _shard_part {
+      struct _shard_chunk *chunk;   ///< chunk the requests belong to
+      uint32 device;                ///< device ID
+      DiskBatch batch;              ///< requests (slice of the chunk)
+    } ShardPart;
+
+    ///@brief requests read from the trace at once
+    typedef struct _shard_chunk {
+      uint64 count;                 ///< number of requests
+      vector<simtime> ts;           ///< timestamps (trace order)
+      vector<uint32> device;        ///< device IDs (trace order)
+      vector<char>   op;            ///< operations (trace order)
+      vector<uint64> address;       ///< addresses (trace order)
+      vector<uint64> size;          ///< sizes (trace order)
+      vector<uint64> slot;          ///< position of each request in the
+                                    ///< per-device arrays below
+      vector<simtime> part_ts;      ///< timestamps grouped by device
+      vector<char>   part_op;       ///< operations grouped by device
+      vector<uint64> part_address;  ///< addresses grouped by device
+      vector<uint64> part_size;     ///< sizes grouped by device
+      vector<simtime> part_done;    ///< completion times grouped by device
+      vector<ShardPart> parts;      ///< per-device batches
+      atomic<uint32> pending;       ///< batches not simulated yet
+    } ShardChunk;
+
+    vector<Disk*> _devices;         ///< devices
+    uint32 _workers;                ///< number of worker threads
+    vector<SPSCQueue<ShardPart*>*> _queued; ///< batches queued per device
+    atomic<bool> *_scheduled;       ///< true while a device is scheduled or
+                                    ///< owned by a worker
+    vector<MPMCQueue<uint32>*> _ready;  ///< devices scheduled on each worker
+    vector<ShardChunk*> _chunks;    ///< chunks
+    atomic<bool> _done;             ///< set when all chunks are written
+    vector<LatencyStats> _latency;  ///< latencies per device
+    TraceSketch *_sketch;           ///< summary of all requests (or NULL)
+    vector<TraceSketch> _sketches;  ///< summaries per device
+    vector<uint64> _steals;         ///< devices stolen by each worker
+    uint64 _invalid;                ///< requests for unknown devices
+    vector<uint64> _first;          ///< first slot of each device in a chunk
+    vector<uint64> _fill;           ///< next free slot of each device
+
+
+    /// @brief read up to SHARD_CHUNK_SIZE requests into @a c and group them
+    ///        by device
+    /// @retval number of requests read (0 at the end of the trace)
+    uint64 parse(istream &in, ShardChunk &c);
+
+    /// @brief queue the batches of @a c on their devices
+    void   dispatch(ShardChunk &c);
+
+    /// @brief make sure @a device is scheduled on a worker
+    /// @param worker worker to schedule the device on
+    void   schedule(uint32 device, uint32 worker);
+
+    /// @brief worker thread
+    /// @param id worker number
+    void   work(uint32 id);
+
+    /// @brief simulate up to SHARD_TURN queued batches of @a device
+    /// @param worker worker simulating the device
+    void   serve(uint32 device, uint32 worker);
+
+    /// @brief print the requests of @a c with their completion times
+    void   print(ostream &out, const ShardChunk &c);
+};
+
+#endif // __CA_SHARD_H__
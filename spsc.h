@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+/// @brief lock-free single-producer/single-consumer ring buffer
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_SPSC_H__
+#define __CA_SPSC_H__
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "disk.h"
+using namespace std;
+
+// size of a cache line; the producer and consumer indices live on separate
+// lines so that the two threads do not invalidate each other's cache
+#define SPSC_CACHE_LINE  64
+
+// unsuccessful attempts before a waiting thread yields the CPU, and before it
+// sleeps (for SPSC_SLEEP_US microseconds) between attempts
+#define SPSC_SPINS       64
+#define SPSC_YIELDS      256
+#define SPSC_SLEEP_US    50
+
+//------------------------------------------------------------------------------
+/// @brief back off while waiting for another thread
+/// @param spins number of unsuccessful attempts so far
+inline void spin_wait(uint32 spins)
+{
+  // a waiting thread is usually released soon: spin briefly before giving up
+  // the CPU. A thread waiting for much longer (e.g., when there are fewer
+  // cores than threads) sleeps so that the busy threads get the CPU.
+  if (spins >= SPSC_SPINS + SPSC_YIELDS)
+    this_thread::sleep_for(chrono::microseconds(SPSC_SLEEP_US));
+  else if (spins >= SPSC_SPINS)
+    this_thread::yield();
+}
+
+//------------------------------------------------------------------------------
+/// @brief bounded lock-free queue for exactly one producer and one consumer
+///
+/// SPSCQueue is a ring buffer whose capacity is a power of two. The producer
+/// only writes _tail and the consumer only writes _head; each publishes its
+/// index with release semantics and reads the other's with acquire semantics,
+/// so no locks or read-modify-write operations are needed. put() and get()
+/// block (spinning, then yielding, then sleeping) while the queue is full or
+/// empty, which gives the producer backpressure from a slow consumer.
+///
+template <class T>
+class SPSCQueue {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param capacity minimal number of elements (rounded up to a power of 2)
+    SPSCQueue(uint64 capacity);
+
+    /// @brief destructor
+    ~SPSCQueue(void) {};
+
+    /// @}
+
+
+    /// @name queue operations
+    /// @{
+
+    /// @brief append @a value if the queue is not full (producer only)
+    /// @retval true if @a value was appended, false if the queue was full
+    bool   push(const T &value);
+
+    /// @brief remove the oldest element if the queue is not empty (consumer
+    ///        only)
+    /// @param value (output) removed element
+    /// @retval true if an element was removed, false if the queue was empty
+    bool   pop(T &value);
+
+    /// @brief append @a value, waiting while the queue is full (producer only)
+    void   put(const T &value);
+
+    /// @brief remove the oldest element, waiting while the queue is empty
+    ///        (consumer only)
+    T      get(void);
+
+    /// @brief true if the queue holds no elements
+    bool   empty(void) const;
+
+    /// @}
+
+
+  protected:
+    vector<T> _slots;               ///< ring buffer
+    uint64 _mask;                   ///< capacity - 1
+    atomic<uint64> _head;           ///< next element to remove
+    char   _pad[SPSC_CACHE_LINE];   ///< keeps _head and _tail apart
+    atomic<uint64> _tail;           ///< next free slot
+};
+
+
+//------------------------------------------------------------------------------
+// SPSCQueue
+//
+template <class T>
+SPSCQueue<T>::SPSCQueue(uint64 capacity)
+  : _head(0), _tail(0)
+{
+  uint64 size = 1;
+  while (size < capacity) size <<= 1;
+
+  _slots.resize(size);
+  _mask = size - 1;
+}
+
+template <class T>
+bool SPSCQueue<T>::push(const T &value)
+{
+  uint64 tail = _tail.load(memory_order_relaxed);
+
+  if (tail - _head.load(memory_order_acquire) > _mask)
+    return false;
+
+  _slots[tail & _mask] = value;
+  _tail.store(tail + 1, memory_order_release);
+
+  return true;
+}
+
+template <class T>
+bool SPSCQueue<T>::pop(T &value)
+{
+  uint64 head = _head.load(memory_order_relaxed);
+
+  if (head == _tail.load(memory_order_acquire))
+    return false;
+
+  value = _slots[head & _mask];
+  _head.store(head + 1, memory_order_release);
+
+  return true;
+}
+
+template <class T>
+void SPSCQueue<T>::put(const T &value)
+{
+  for (uint32 spins = 0; !push(value); spins++)
+    spin_wait(spins);
+}
+
+template <class T>
+T SPSCQueue<T>::get(void)
+{
+  T value;
+
+  for (uint32 spins = 0; !pop(value); spins++)
+    spin_wait(spins);
+
+  return value;
+}
+
+template <class T>
+bool SPSCQueue<T>::empty(void) const
+{
+  return _head.load(memory_order_acquire) == _tail.load(memory_order_acquire);
+}
+
+#endif // __CA_SPSC_H__
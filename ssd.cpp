@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+/// @brief flash-based storage devices (SSD)
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <iomanip>
+
+#include "ssd.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// SSD
+//
+SSD::SSD(double read_latency, double write_latency, double bandwidth,
+         bool verbose)
+  : _verbose(verbose), _read_latency(to_simtime(read_latency)),
+    _write_latency(to_simtime(write_latency))
+{
+  if (bandwidth <= 0.0) {
+    cout << "Error: SSD bandwidth must be positive" << endl;
+    bandwidth = 1.0;
+  }
+  _ps_per_byte = (int64)(1.0e12 / bandwidth + 0.5);
+
+  //
+  // print info
+  //
+  cout.precision(6);
+  cout << "SSD: " << endl
+       << "  read latency:              " << fixed << read_latency << endl
+       << "  write latency:             " << fixed << write_latency << endl
+       << "  bandwidth (MB/s):          " << fixed << bandwidth/1000000.0 << endl
+       << endl;
+}
+
+SSD::~SSD(void)
+{
+}
+
+simtime SSD::read(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "SSD::read(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return ts + _read_latency + ps_to_simtime(size * _ps_per_byte);
+}
+
+simtime SSD::write(simtime ts, uint64 address, uint64 size)
+{
+  if (_verbose)
+    cout << "SSD::write(" << to_seconds(ts) << ", " << hex << address << ", " << hex << size << ")" << dec << endl;
+
+  return ts + _write_latency + ps_to_simtime(size * _ps_per_byte);
+}
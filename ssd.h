@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------
+/// @brief flash-based storage devices (SSD)
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_SSD_H__
+#define __CA_SSD_H__
+
+#include <algorithm>
+
+#include "disk.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief flash-based storage devices (SSD)
+///
+/// The SSD class implements a simple flash disk: every access costs a fixed
+/// per-operation latency plus the transfer time of the data at the device's
+/// bandwidth. Accesses do not depend on the address.
+///
+class SSD : public Disk {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param read_latency fixed latency of a read (seconds)
+    /// @param write_latency fixed latency of a write (seconds)
+    /// @param bandwidth transfer rate (bytes/second)
+    /// @param verbose toggle verbose output
+    SSD(double read_latency, double write_latency, double bandwidth,
+        bool verbose=false);
+
+    /// @brief destructor
+    virtual ~SSD(void);
+
+    /// @brief copy of the SSD
+    virtual Disk* clone(void) const { return new SSD(*this); };
+
+    /// @}
+
+
+    /// @name access methods
+    /// @{
+
+    /// @brief read @a size bytes from @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to read
+    /// @param size number of bytes to read
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime read(simtime ts, uint64 address, uint64 size);
+
+    /// @brief write @a size bytes to @a address
+    /// @param ts timestamp of the event
+    /// @param address starting address (in bytes) of data to write
+    /// @param size number of bytes to write
+    /// @retval time when the access ends (ts + latency of access)
+    virtual simtime write(simtime ts, uint64 address, uint64 size);
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief the SSD is stateless; nothing is written
+    virtual bool save(ostream & /*os*/) { return true; };
+
+    /// @brief the SSD is stateless; nothing is read
+    virtual bool load(istream & /*is*/) { return true; };
+
+    /// @}
+
+
+  protected:
+    bool   _verbose;                ///< toggle verbose output
+    simtime _read_latency;          ///< fixed latency of a read
+    simtime _write_latency;         ///< fixed latency of a write
+    int64  _ps_per_byte;            ///< transfer time per byte (picoseconds)
+};
+
+#endif // __CA_SSD_H__
@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+/// @brief latency statistics
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+#include <iostream>
+#include <iomanip>
+
+#include "stats.h"
+#include "checkpoint.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+// LatencyStats
+//
+LatencyStats::LatencyStats(double alpha)
+  : _bounded(false)
+{
+  reset();
+  set_accuracy(alpha);
+}
+
+LatencyStats::~LatencyStats(void)
+{
+}
+
+void LatencyStats::set_accuracy(double alpha)
+{
+  if ((alpha > 0.0) && !_bounded) bound(alpha);
+}
+
+void LatencyStats::bound(double alpha)
+{
+  _sketch = QuantileSketch(alpha);
+  for (uint64 i = 0; i < _samples.size(); i++)
+    _sketch.add(_samples[i]);
+
+  _samples.clear();
+  _samples.shrink_to_fit();
+  _sorted = true;
+  _bounded = true;
+}
+
+void LatencyStats::add(simtime latency)
+{
+  if ((_count == 0) || (latency < _min)) _min = latency;
+  if ((_count == 0) || (latency > _max)) _max = latency;
+
+  if (_bounded) {
+    _sketch.add(latency);
+  } else {
+    _samples.push_back(latency);
+    _sorted = false;
+  }
+  _count++;
+  _sum += latency;
+}
+
+void LatencyStats::merge(const LatencyStats &other)
+{
+  if (other._count == 0)
+    return;
+
+  if ((_count == 0) || (other._min < _min)) _min = other._min;
+  if ((_count == 0) || (other._max > _max)) _max = other._max;
+
+  // the merged distribution is exact only if both are
+  if (other._bounded && !_bounded) bound(other._sketch.accuracy());
+
+  if (!_bounded) {
+    _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+    _sorted = false;
+  } else if (other._bounded) {
+    _sketch.merge(other._sketch);
+  } else {
+    for (uint64 i = 0; i < other._samples.size(); i++)
+      _sketch.add(other._samples[i]);
+  }
+  _count += other._count;
+  _sum += other._sum;
+}
+
+void LatencyStats::reset(void)
+{
+  _samples.clear();
+  _sketch.reset();
+  _sorted = true;
+  _count = 0;
+  _sum = 0;
+  _min = _max = 0;
+}
+
+double LatencyStats::mean(void) const
+{
+  return _count > 0 ? to_seconds(_sum) / _count : 0.0;
+}
+
+simtime LatencyStats::min(void) const
+{
+  return _min;
+}
+
+simtime LatencyStats::max(void) const
+{
+  return _max;
+}
+
+simtime LatencyStats::percentile(double p)
+{
+  if (_bounded) {
+    if (_count == 0) return 0;
+    if (p <= 0.0) return _min;
+    if (p >= 100.0) return _max;
+    return ::max(_min, ::min(_max, _sketch.quantile(p / 100.0)));
+  }
+
+  if (_samples.empty())
+    return 0;
+
+  if (!_sorted) {
+    sort(_samples.begin(), _samples.end());
+    _sorted = true;
+  }
+
+  // nearest-rank percentile
+  if (p <= 0.0) return _samples.front();
+  if (p >= 100.0) return _samples.back();
+
+  uint64 rank = (uint64)ceil(p / 100.0 * _samples.size());
+  if (rank > 0) rank--;
+
+  return _samples[rank];
+}
+
+void LatencyStats::print(ostream &os, const char *indent)
+{
+  os.precision(6);
+  os << indent << "requests:     " << dec << _count << endl
+     << indent << "mean latency: " << fixed << mean() << endl
+     << indent << "min latency:  " << fixed << to_seconds(min()) << endl
+     << indent << "p50 latency:  " << fixed << to_seconds(percentile(50.0)) << endl
+     << indent << "p90 latency:  " << fixed << to_seconds(percentile(90.0)) << endl
+     << indent << "p99 latency:  " << fixed << to_seconds(percentile(99.0)) << endl
+     << indent << "p999 latency: " << fixed << to_seconds(percentile(99.9)) << endl
+     << indent << "max latency:  " << fixed << to_seconds(max()) << endl;
+}
+
+void LatencyStats::save(ostream &os) const
+{
+  ckpt_put(os, _samples);
+  ckpt_put(os, _sorted);
+  ckpt_put(os, _count);
+  ckpt_put(os, _sum);
+  ckpt_put(os, _min);
+  ckpt_put(os, _max);
+  ckpt_put(os, _bounded);
+  if (_bounded) _sketch.save(os);
+}
+
+bool LatencyStats::load(istream &is)
+{
+  return ckpt_get(is, _samples) && ckpt_get(is, _sorted) && ckpt_get(is, _count) &&
+         ckpt_get(is, _sum) && ckpt_get(is, _min) && ckpt_get(is, _max) &&
+         ckpt_get(is, _bounded) && (!_bounded || _sketch.load(is));
+}
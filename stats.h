@@ -0,0 +1,151 @@
+//------------------------------------------------------------------------------
+/// @brief latency statistics
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_STATS_H__
+#define __CA_STATS_H__
+
+#include <iostream>
+#include <vector>
+
+#include "disk.h"
+#include "quantile_sketch.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief latency statistics
+///
+/// LatencyStats accumulates the latencies of simulated accesses and reports
+/// their mean, extremes and distribution (percentiles). By default, all
+/// samples are kept and percentiles are exact. Statistics with a positive
+/// accuracy keep a QuantileSketch instead: memory stays bounded on endless
+/// traces, and percentiles are within the given relative accuracy. Mean,
+/// minimum and maximum are always exact.
+///
+class LatencyStats {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param alpha relative accuracy of the percentiles (0: keep all
+    ///        samples)
+    LatencyStats(double alpha=0.0);
+
+    /// @brief destructor
+    ~LatencyStats(void);
+
+    /// @brief keep a quantile sketch of relative accuracy @a alpha instead
+    ///        of all samples, adding the samples kept so far. Ignored if
+    ///        @a alpha is 0 or a sketch is kept already.
+    void set_accuracy(double alpha);
+
+    /// @}
+
+
+    /// @name accumulation
+    /// @{
+
+    /// @brief add a single latency sample
+    /// @param latency latency
+    void add(simtime latency);
+
+    /// @brief merge the samples of @a other into this accumulator
+    /// @param other statistics to merge
+    void merge(const LatencyStats &other);
+
+    /// @brief discard all samples
+    void reset(void);
+
+    /// @}
+
+
+    /// @name queries
+    /// @{
+
+    /// @brief number of samples
+    uint64 count(void) const { return _count; };
+
+    /// @brief sum of all samples
+    simtime sum(void) const { return _sum; };
+
+    /// @brief mean latency in seconds (0 if no samples)
+    double mean(void) const;
+
+    /// @brief smallest latency (0 if no samples)
+    simtime min(void) const;
+
+    /// @brief largest latency (0 if no samples)
+    simtime max(void) const;
+
+    /// @brief latency at percentile @a p
+    /// @param p percentile in [0, 100]
+    /// @retval latency below which @a p percent of the samples lie
+    simtime percentile(double p);
+
+    /// @brief print a summary of the distribution
+    /// @param os output stream
+    /// @param indent prefix for every line
+    void print(ostream &os, const char *indent = "  ");
+
+    /// @}
+
+
+    /// @name checkpointing
+    /// @{
+
+    /// @brief write all samples (or the sketch) to a binary checkpoint
+    void save(ostream &os) const;
+
+    /// @brief restore the samples written by save()
+    /// @retval true on success, false otherwise
+    bool load(istream &is);
+
+    /// @}
+
+
+  protected:
+    vector<simtime> _samples;       ///< all samples (sorted lazily)
+    bool   _sorted;                 ///< true if _samples is sorted
+    uint64 _count;                  ///< number of samples
+    simtime _sum;                   ///< sum of all samples
+    simtime _min;                   ///< smallest sample
+    simtime _max;                   ///< largest sample
+    bool   _bounded;                ///< true if samples go to _sketch only
+    QuantileSketch _sketch;         ///< distribution (if _bounded)
+
+
+    /// @brief switch to a sketch of accuracy @a alpha, adding the samples
+    ///        kept so far
+    void bound(double alpha);
+};
+
+#endif // __CA_STATS_H__
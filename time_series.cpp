@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+/// @brief windowed time-series metrics
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <iomanip>
+
+#include "time_series.h"
+#include "checkpoint.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// TimeSeries
+//
+TimeSeries::TimeSeries(simtime interval, bool binary)
+  : _interval(interval > 0 ? interval : NS_PER_SEC), _binary(binary), _started(false),
+    _start(0), _depth_cover(0), _busy_cover(0), _busy_until(0),
+    _requests(0), _bytes(0), _latency_sum(0.0), _latency(TIME_SERIES_ACCURACY), _rows(0)
+{
+}
+
+bool TimeSeries::open(const char *filename)
+{
+  _out.open(filename, _binary ? ios::out | ios::binary : ios::out);
+  if (!_out.good()) {
+    cout << "Error: cannot create time series '" << filename << "'" << endl;
+    return false;
+  }
+
+  if (_binary) {
+    _out.write(TIME_SERIES_MAGIC, 4);
+    ckpt_put(_out, (uint32)TIME_SERIES_VERSION);
+    ckpt_put(_out, _interval);
+  } else {
+    _out << "start,requests,iops,mbps,mean_latency,p99_latency,queue_depth,utilization\n";
+  }
+
+  return _out.good();
+}
+
+void TimeSeries::add(simtime ts, simtime done, uint64 size)
+{
+  if (!_started) {
+    // align the windows to multiples of the interval
+    _start = (ts / _interval - (ts % _interval < 0 ? 1 : 0)) * _interval;
+    _busy_until = _start;
+    _windows.push_back(TimeSeriesWindow());
+    _started = true;
+  }
+
+  advance(ts);
+
+  _requests++;
+  _bytes += size;
+  _latency_sum += to_seconds(done - ts);
+  _latency.add(done - ts);
+
+  // out of order; the earlier windows have been written already
+  if (ts < _start) ts = _start;
+
+  if (done > ts) {
+    cover(ts, done, false);
+
+    // the part of the request outside all earlier busy periods
+    simtime from = max(ts, _busy_until);
+    if (done > from) {
+      cover(from, done, true);
+      _busy_until = done;
+    }
+  }
+}
+
+bool TimeSeries::close(void)
+{
+  if (_started) {
+    do {
+      flush();
+    } while (_start < _busy_until);
+  }
+
+  _out.flush();
+  if (!_out.good()) {
+    cout << "Error: cannot write time series" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+void TimeSeries::advance(simtime ts)
+{
+  while (ts >= _start + _interval)
+    flush();
+}
+
+void TimeSeries::flush(void)
+{
+  TimeSeriesWindow &w = _windows.front();
+  TimeSeriesRow row;
+  double length = to_seconds(_interval);
+
+  _depth_cover += w.depth_cover;
+  _busy_cover += w.busy_cover;
+
+  row.start = to_seconds(_start);
+  row.requests = _requests;
+  row.iops = _requests / length;
+  row.mbps = _bytes / length / 1e6;
+  row.mean = _requests > 0 ? _latency_sum / _requests : 0.0;
+  row.p99 = to_seconds(_latency.quantile(0.99));
+  row.queue_depth = to_seconds(w.depth + _depth_cover * _interval) / length;
+  row.utilization = to_seconds(w.busy + _busy_cover * _interval) / length;
+
+  if (_binary) {
+    ckpt_put(_out, row);
+  } else {
+    _out.precision(6);
+    _out << fixed << row.start << ',' << row.requests << ',' << row.iops << ','
+         << row.mbps << ',' << row.mean << ',' << row.p99 << ','
+         << row.queue_depth << ',' << row.utilization << '\n';
+  }
+  _rows++;
+
+  _windows.pop_front();
+  if (_windows.empty()) _windows.push_back(TimeSeriesWindow());
+  _start += _interval;
+
+  _requests = _bytes = 0;
+  _latency_sum = 0.0;
+  _latency.reset();
+}
+
+void TimeSeries::cover(simtime from, simtime to, bool busy)
+{
+  uint64 first = (from - _start) / _interval;
+  uint64 last = (to - 1 - _start) / _interval;
+
+  if (last >= _windows.size())
+    _windows.resize(last + 1, TimeSeriesWindow());
+
+  simtime &first_part = busy ? _windows[first].busy : _windows[first].depth;
+  if (first == last) {
+    first_part += to - from;
+    return;
+  }
+
+  simtime &last_part = busy ? _windows[last].busy : _windows[last].depth;
+  first_part += _start + (simtime)(first + 1) * _interval - from;
+  last_part += to - (_start + (simtime)last * _interval);
+
+  // the windows in between are covered entirely
+  if (last > first + 1) {
+    int64 &enter = busy ? _windows[first + 1].busy_cover : _windows[first + 1].depth_cover;
+    enter++;
+    int64 &leave = busy ? _windows[last].busy_cover : _windows[last].depth_cover;
+    leave--;
+  }
+}
@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+/// @brief windowed time-series metrics
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TIME_SERIES_H__
+#define __CA_TIME_SERIES_H__
+
+#include <deque>
+#include <fstream>
+#include <iostream>
+
+#include "disk.h"
+#include "quantile_sketch.h"
+using namespace std;
+
+// binary time series signature and format version
+#define TIME_SERIES_MAGIC    "TSER"
+#define TIME_SERIES_VERSION  1
+
+// relative accuracy of the latency percentiles of a window
+#define TIME_SERIES_ACCURACY 0.01
+
+///@brief metrics of one window (the record of a binary time series)
+typedef struct _time_series_row {
+  double start;                     ///< start of the window (seconds)
+  uint64 requests;                  ///< requests that arrived in the window
+  double iops;                      ///< arrivals per second
+  double mbps;                      ///< bytes per second of the arrivals
+                                    ///< (in 10^6 bytes)
+  double mean;                      ///< mean latency of the arrivals (s)
+  double p99;                       ///< 99th percentile latency (s)
+  double queue_depth;               ///< average number of outstanding
+                                    ///< requests
+  double utilization;               ///< fraction of the window with at least
+                                    ///< one outstanding request
+} TimeSeriesRow;
+
+///@brief accumulated time of a pending window
+typedef struct _time_series_window {
+  simtime depth;                    ///< outstanding time of partly covering
+                                    ///< requests
+  int64  depth_cover;               ///< change in the number of requests
+                                    ///< covering the whole window
+  simtime busy;                     ///< partly covered busy time
+  int64  busy_cover;                ///< change in the number of busy periods
+                                    ///< covering the whole window
+} TimeSeriesWindow;
+
+//------------------------------------------------------------------------------
+/// @brief metrics per interval of simulated time
+///
+/// TimeSeries aggregates the requests of a replay in windows of a fixed
+/// length aligned to multiples of the interval and writes one row per
+/// window, as CSV or as a compact binary file (a header followed by
+/// TimeSeriesRow records). Requests count towards the window of their
+/// arrival; the queue depth and utilization account for the time every
+/// request is outstanding, [arrival, completion), in all windows it spans.
+/// Requests must be added in arrival order. A window is written as soon as
+/// a later arrival shows that it is complete, so memory depends only on
+/// the longest latency, not on the length of the trace.
+///
+class TimeSeries {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param interval window length
+    /// @param binary write binary records instead of CSV
+    TimeSeries(simtime interval, bool binary=false);
+
+    /// @brief destructor
+    ~TimeSeries(void) {};
+
+    /// @}
+
+
+    /// @name aggregation
+    /// @{
+
+    /// @brief create the output file and write its header
+    /// @param filename output file
+    /// @retval true on success, false otherwise
+    bool   open(const char *filename);
+
+    /// @brief account a request
+    /// @param ts arrival time
+    /// @param done completion time
+    /// @param size number of bytes
+    void   add(simtime ts, simtime done, uint64 size);
+
+    /// @brief write the remaining windows up to the last completion
+    /// @retval true on success, false if the output could not be written
+    bool   close(void);
+
+    /// @brief number of rows written
+    uint64 rows(void) const { return _rows; };
+
+    /// @}
+
+
+  protected:
+    simtime _interval;              ///< window length
+    bool   _binary;                 ///< write binary records
+    ofstream _out;                  ///< output file
+    bool   _started;                ///< true after the first request
+    simtime _start;                 ///< start of the current window
+    deque<TimeSeriesWindow> _windows; ///< current and later windows
+    int64  _depth_cover;            ///< requests covering the current window
+    int64  _busy_cover;             ///< busy periods covering the window
+    simtime _busy_until;            ///< end of the latest busy period
+    uint64 _requests;               ///< arrivals in the current window
+    uint64 _bytes;                  ///< bytes of these arrivals
+    double _latency_sum;            ///< sum of their latencies (s)
+    QuantileSketch _latency;        ///< their latencies
+    uint64 _rows;                   ///< rows written
+
+
+    /// @brief write the rows of all windows that end at or before @a ts
+    void   advance(simtime ts);
+
+    /// @brief write the row of the current window and move to the next one
+    void   flush(void);
+
+    /// @brief account the time in [@a from, @a to) as outstanding (@a busy
+    ///        = false) or busy time of the pending windows
+    void   cover(simtime from, simtime to, bool busy);
+};
+
+#endif // __CA_TIME_SERIES_H__
@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+/// @brief time index of trace files
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sys/stat.h>
+
+#include "checkpoint.h"
+#include "trace_index.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// TraceIndex
+//
+TraceIndex::TraceIndex(void)
+  : _start(0), _size(0), _mtime(0), _checksum(0), _records(0)
+{
+}
+
+bool TraceIndex::open(const char *trace, int64 start)
+{
+  string sidecar = string(trace) + ".idx";
+  int64 size, mtime;
+  uint64 checksum;
+
+  if (!identify(trace, size, mtime, checksum)) {
+    cout << "Error: cannot open trace '" << trace << "'" << endl;
+    return false;
+  }
+
+  if (load(sidecar.c_str(), size, mtime, checksum, start))
+    return true;
+
+  if (!build(trace, start))
+    return false;
+  _mtime = mtime;
+  _checksum = checksum;
+
+  // an index that cannot be stored is still valid for this run
+  save(sidecar.c_str());
+
+  return true;
+}
+
+bool TraceIndex::build(const char *trace, int64 start)
+{
+  ifstream f(trace, ios::binary);
+  string line;
+  int64 offset = start;
+
+  if (!f.good()) {
+    cout << "Error: cannot open trace '" << trace << "'" << endl;
+    return false;
+  }
+
+  _entries.clear();
+  _start = start;
+  _records = 0;
+
+  f.seekg(start);
+
+  // offsets are accumulated from the line lengths; tellg() per line would
+  // dominate the pass
+  while (getline(f, line)) {
+    int64 next = offset + line.size() + (f.eof() ? 0 : 1);
+    const char *p = line.c_str();
+    char *end;
+    double t = strtod(p, &end);
+
+    if (end != p) {
+      if (_records % TRACE_INDEX_STRIDE == 0) {
+        TraceIndexEntry e;
+        e.ts = to_simtime(t);
+        e.offset = offset;
+        _entries.push_back(e);
+      }
+      _records++;
+    }
+    offset = next;
+  }
+  _size = offset;
+
+  return true;
+}
+
+bool TraceIndex::identify(const char *trace, int64 &size, int64 &mtime,
+                          uint64 &checksum)
+{
+  ifstream f(trace, ios::binary);
+  struct stat st;
+  char buf[TRACE_INDEX_CHECK];
+
+  if (!f.good() || (stat(trace, &st) != 0))
+    return false;
+
+  size = (int64)st.st_size;
+  mtime = (int64)st.st_mtime;
+
+  // FNV-1a; catches edits that keep the size and happen within the
+  // resolution of the modification time
+  f.read(buf, TRACE_INDEX_CHECK);
+  checksum = 14695981039346656037ULL;
+  for (streamsize i = 0; i < f.gcount(); i++) {
+    checksum ^= (uint8)buf[i];
+    checksum *= 1099511628211ULL;
+  }
+
+  return true;
+}
+
+bool TraceIndex::load(const char *filename, int64 size, int64 mtime,
+                      uint64 checksum, int64 start)
+{
+  ifstream f(filename, ios::binary);
+  char magic[4];
+  uint32 version, stride;
+
+  if (!f.good())
+    return false;
+
+  f.read(magic, 4);
+  if (!f.good() || (memcmp(magic, TRACE_INDEX_MAGIC, 4) != 0))
+    return false;
+
+  if (!ckpt_get(f, version) || (version != TRACE_INDEX_VERSION) ||
+      !ckpt_get(f, stride) || (stride != TRACE_INDEX_STRIDE) ||
+      !ckpt_get(f, _size) || (_size != size) ||
+      !ckpt_get(f, _mtime) || (_mtime != mtime) ||
+      !ckpt_get(f, _checksum) || (_checksum != checksum) ||
+      !ckpt_get(f, _start) || (_start != start) ||
+      !ckpt_get(f, _records) || !ckpt_get(f, _entries)) {
+    _entries.clear();
+    return false;
+  }
+
+  return true;
+}
+
+bool TraceIndex::save(const char *filename) const
+{
+  ofstream f(filename, ios::binary);
+
+  f.write(TRACE_INDEX_MAGIC, 4);
+  ckpt_put(f, (uint32)TRACE_INDEX_VERSION);
+  ckpt_put(f, (uint32)TRACE_INDEX_STRIDE);
+  ckpt_put(f, _size);
+  ckpt_put(f, _mtime);
+  ckpt_put(f, _checksum);
+  ckpt_put(f, _start);
+  ckpt_put(f, _records);
+  ckpt_put(f, _entries);
+
+  if (!f.good()) {
+    cout << "Error: cannot write trace index '" << filename << "'" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+int64 TraceIndex::offset(simtime t) const
+{
+  // last entry before t: all records preceding it are earlier than t as well
+  uint64 lo = 0, hi = _entries.size();
+
+  while (lo < hi) {
+    uint64 mid = (lo + hi) / 2;
+    if (_entries[mid].ts < t) lo = mid + 1;
+    else hi = mid;
+  }
+
+  return lo > 0 ? _entries[lo-1].offset : _start;
+}
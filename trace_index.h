@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+/// @brief time index of trace files
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_INDEX_H__
+#define __CA_TRACE_INDEX_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "disk.h"
+using namespace std;
+
+// number of trace records between two index entries
+#define TRACE_INDEX_STRIDE  4096
+
+// signature and format version of index files
+#define TRACE_INDEX_MAGIC    "TIDX"
+#define TRACE_INDEX_VERSION  2
+
+// number of leading bytes of a trace covered by the checksum of its index
+#define TRACE_INDEX_CHECK    65536
+
+///@brief entry of a trace index
+typedef struct _trace_index_entry {
+  simtime ts;                       ///< timestamp of the record
+  int64  offset;                    ///< file offset of the record
+} TraceIndexEntry;
+
+//------------------------------------------------------------------------------
+/// @brief time index of a trace file
+///
+/// TraceIndex maps timestamps to file offsets of a trace so that a replay of
+/// a time window can start close to the window instead of parsing the trace
+/// from its beginning. The index holds the timestamp and offset of every
+/// TRACE_INDEX_STRIDE-th record. It is built in a single streaming pass over
+/// the trace and stored in a sidecar file "<trace>.idx", which is reused as
+/// long as the size, modification time and a checksum of the first
+/// TRACE_INDEX_CHECK bytes of the trace do not change. The records of the
+/// trace must be sorted by time.
+///
+class TraceIndex {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    TraceIndex(void);
+
+    /// @brief destructor
+    ~TraceIndex(void) {};
+
+    /// @}
+
+
+    /// @name index construction
+    /// @{
+
+    /// @brief load the sidecar index of @a trace, or build and store it if it
+    ///        is missing or stale
+    /// @param trace name of the trace file
+    /// @param start offset of the first record (after the device parameters)
+    /// @retval true on success, false otherwise
+    bool   open(const char *trace, int64 start);
+
+    /// @brief build the index in one pass over the records of @a trace
+    /// @param trace name of the trace file
+    /// @param start offset of the first record
+    /// @retval true on success, false otherwise
+    bool   build(const char *trace, int64 start);
+
+    /// @brief load a sidecar index file
+    /// @param filename name of the index file
+    /// @param size expected size of the trace
+    /// @param mtime expected modification time of the trace
+    /// @param checksum expected checksum of the first bytes of the trace
+    /// @param start expected offset of the first record
+    /// @retval true if the index is valid for the trace, false otherwise
+    bool   load(const char *filename, int64 size, int64 mtime,
+                uint64 checksum, int64 start);
+
+    /// @brief store the index in a sidecar file
+    /// @param filename name of the index file
+    /// @retval true on success, false otherwise
+    bool   save(const char *filename) const;
+
+    /// @}
+
+
+    /// @name queries
+    /// @{
+
+    /// @brief offset from which all records with timestamps >= @a t follow
+    /// @param t timestamp
+    /// @retval file offset of a record at or before the first record at @a t
+    int64  offset(simtime t) const;
+
+    /// @brief number of indexed entries
+    uint64 entries(void) const { return _entries.size(); };
+
+    /// @brief number of records in the trace
+    uint64 records(void) const { return _records; };
+
+    /// @}
+
+
+  protected:
+    vector<TraceIndexEntry> _entries; ///< indexed records in trace order
+    int64  _start;                  ///< offset of the first record
+    int64  _size;                   ///< size of the indexed trace (bytes)
+    int64  _mtime;                  ///< modification time of the trace
+    uint64 _checksum;               ///< checksum of the first bytes of the trace
+    uint64 _records;                ///< number of records in the trace
+
+
+    /// @brief identify the current contents of @a trace
+    /// @param trace name of the trace file
+    /// @param size (out) size of the trace (bytes)
+    /// @param mtime (out) modification time of the trace
+    /// @param checksum (out) checksum of the first TRACE_INDEX_CHECK bytes
+    /// @retval true on success, false otherwise
+    static bool identify(const char *trace, int64 &size, int64 &mtime,
+                         uint64 &checksum);
+};
+
+#endif // __CA_TRACE_INDEX_H__
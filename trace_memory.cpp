@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+/// @brief traces held in memory
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "trace_memory.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// MemoryTrace
+//
+uint64 MemoryTrace::load(TraceSource *source)
+{
+  TraceRecord r;
+
+  while (source->next(r)) {
+    _ts.push_back(r.ts);
+    _op.push_back(r.op);
+    _address.push_back(r.address);
+    _size.push_back(r.size);
+  }
+
+  return _ts.size();
+}
+
+simtime MemoryTrace::serve(Disk *device, uint64 i, simtime arrival, simtime &busy) const
+{
+  simtime start = max(arrival, busy);
+  simtime done = start;
+
+  switch (_op[i]) {
+    case 'r': done = device->read(start, _address[i], _size[i]); break;
+    case 'w': done = device->write(start, _address[i], _size[i]); break;
+  }
+  busy = done;
+
+  return done;
+}
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+/// @brief traces held in memory
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_MEMORY_H__
+#define __CA_TRACE_MEMORY_H__
+
+#include <vector>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief trace held in memory
+///
+/// MemoryTrace reads all requests of a TraceSource into memory (struct of
+/// arrays) so that they can be replayed many times, e.g., at different loads
+/// or with different numbers of clients. It also provides the queueing model
+/// these replays share: the device serves one request at a time in the order
+/// of arrival.
+///
+class MemoryTrace {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    MemoryTrace(void) {};
+
+    /// @brief destructor
+    ~MemoryTrace(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief append the requests of @a source
+    /// @param source requests (not owned)
+    /// @retval number of requests
+    uint64 load(TraceSource *source);
+
+    /// @brief number of requests
+    uint64 count(void) const { return _ts.size(); };
+
+    /// @brief timestamp of request @a i
+    simtime ts(uint64 i) const { return _ts[i]; };
+
+    /// @brief operation of request @a i
+    char   op(uint64 i) const { return _op[i]; };
+
+    /// @brief starting address (in bytes) of request @a i
+    uint64 address(uint64 i) const { return _address[i]; };
+
+    /// @brief starting addresses of all requests (for batch kernels)
+    const uint64* addresses(void) const { return _address.data(); };
+
+    /// @brief number of bytes of request @a i
+    uint64 size(uint64 i) const { return _size[i]; };
+
+    /// @brief arrival time of request @a i with the time since the first
+    ///        request divided by @a factor
+    simtime arrival(uint64 i, double factor) const
+    {
+      return _ts[0] + (simtime)((_ts[i] - _ts[0]) / factor);
+    };
+
+    /// @}
+
+
+    /// @name queueing
+    /// @{
+
+    /// @brief serve request @a i on @a device, which serves one request at
+    ///        a time in the order of arrival
+    /// @param device device
+    /// @param i request
+    /// @param arrival arrival time of the request
+    /// @param busy (in/out) time at which @a device is idle
+    /// @retval time when the access ends (the start of the service for
+    ///         operations other than 'r' and 'w')
+    simtime serve(Disk *device, uint64 i, simtime arrival, simtime &busy) const;
+
+    /// @}
+
+
+  protected:
+    vector<simtime> _ts;            ///< timestamps
+    vector<char>   _op;             ///< operations
+    vector<uint64> _address;        ///< addresses
+    vector<uint64> _size;           ///< sizes
+};
+
+#endif // __CA_TRACE_MEMORY_H__
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+/// @brief streaming k-way merge of traces
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "trace_merge.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// TraceMerge
+//
+TraceMerge::TraceMerge(void)
+{
+}
+
+TraceMerge::~TraceMerge(void)
+{
+  for (uint32 s = 0; s < _readers.size(); s++) {
+    delete _readers[s];
+    delete _files[s];
+  }
+}
+
+bool TraceMerge::add(const char *filename, uint64 offset, simtime shift)
+{
+  ifstream *f = new ifstream(filename);
+
+  if (!f->good()) {
+    cout << "Error: cannot open trace '" << filename << "'" << endl;
+    delete f;
+    return false;
+  }
+
+  uint32 s = _readers.size();
+  _names.push_back(filename);
+  _files.push_back(f);
+  _readers.push_back(new TraceReader(*f, s, offset, shift));
+  _head.resize(s + 1);
+
+  if (_readers[s]->next(_head[s]))
+    _heap.push(MergeKey(_head[s].ts, s));
+
+  return true;
+}
+
+bool TraceMerge::next(TraceRecord &r)
+{
+  if (_heap.empty())
+    return false;
+
+  uint32 s = _heap.top().second;
+  _heap.pop();
+  r = _head[s];
+
+  if (_readers[s]->next(_head[s]))
+    _heap.push(MergeKey(_head[s].ts, s));
+
+  return true;
+}
@@ -0,0 +1,113 @@
+//------------------------------------------------------------------------------
+/// @brief streaming k-way merge of traces
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_MERGE_H__
+#define __CA_TRACE_MERGE_H__
+
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "disk.h"
+#include "trace_reader.h"
+#include "trace_source.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief streaming k-way merge of trace files
+///
+/// TraceMerge interleaves the requests of several traces (e.g., of the VMs
+/// consolidated onto one device) in timestamp order. Each trace is read by
+/// its own TraceReader with an optional address offset and time shift, and
+/// its requests are tagged with the index of the trace. A min-heap holds the
+/// next request of every trace, so memory does not grow with the length of
+/// the traces. Requests with equal timestamps are delivered in the order in
+/// which the traces were added. Every trace must be sorted by time.
+///
+class TraceMerge : public TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    TraceMerge(void);
+
+    /// @brief destructor
+    virtual ~TraceMerge(void);
+
+    /// @}
+
+
+    /// @name traces
+    /// @{
+
+    /// @brief add a trace file; its requests form the next stream
+    /// @param filename trace file ("<time> <r|w> <address> <length>")
+    /// @param offset added to the address of every request (bytes)
+    /// @param shift added to the timestamp of every request
+    /// @retval true on success, false if the file cannot be opened
+    bool   add(const char *filename, uint64 offset=0, simtime shift=0);
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief read the next record of all traces in timestamp order
+    /// @param r (output) record
+    /// @retval true if a record was read, false at the end of all traces
+    virtual bool next(TraceRecord &r);
+
+    /// @brief number of traces
+    virtual uint32 streams(void) const { return _readers.size(); };
+
+    /// @brief file name of the trace of @a stream
+    virtual const char* name(uint32 stream) const { return _names[stream].c_str(); };
+
+    /// @}
+
+
+  protected:
+    typedef pair<simtime, uint32> MergeKey;  ///< next timestamp of a stream
+
+    vector<string> _names;          ///< file names
+    vector<ifstream*> _files;       ///< trace files
+    vector<TraceReader*> _readers;  ///< readers of the files
+    vector<TraceRecord> _head;      ///< next record of every stream
+    priority_queue<MergeKey, vector<MergeKey>, greater<MergeKey> > _heap;
+                                    ///< streams ordered by their next record
+};
+
+#endif // __CA_TRACE_MERGE_H__
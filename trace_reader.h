@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+/// @brief reader of trace streams
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_READER_H__
+#define __CA_TRACE_READER_H__
+
+#include <iostream>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+//------------------------------------------------------------------------------
+/// @brief trace records of a stream
+///
+/// TraceReader parses requests ("<time> <r|w> <address> <length>") from a
+/// stream. The addresses and timestamps can be moved by a fixed offset, e.g.,
+/// to place the trace of a tenant in its own part of a consolidated device.
+///
+class TraceReader : public TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param in trace (not owned)
+    /// @param stream stream ID the records are tagged with
+    /// @param offset added to the address of every request (bytes)
+    /// @param shift added to the timestamp of every request
+    TraceReader(istream &in, uint32 stream=0, uint64 offset=0, simtime shift=0);
+
+    /// @brief destructor
+    virtual ~TraceReader(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief read the next record
+    /// @param r (output) record
+    /// @retval true if a record was read, false at the end of the trace
+    virtual bool next(TraceRecord &r);
+
+    /// @brief number of records read so far
+    uint64 records(void) const { return _records; };
+
+    /// @}
+
+
+  protected:
+    istream &_in;                   ///< trace
+    uint32 _stream;                 ///< stream ID
+    uint64 _offset;                 ///< address offset (bytes)
+    simtime _shift;                 ///< time shift
+    uint64 _records;                ///< records read
+};
+
+#endif // __CA_TRACE_READER_H__
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+/// @brief bounded reordering of trace records
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <functional>
+#include <iostream>
+#include <iomanip>
+
+#include "trace_reorder.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// ReorderBuffer
+//
+ReorderBuffer::ReorderBuffer(TraceSource *source, uint32 window)
+  : _source(source), _window(window > 0 ? window : 1), _seq(0), _released(false),
+    _last(0), _reordered(0), _late(0), _max_late(0), _prev(0)
+{
+}
+
+bool ReorderBuffer::next(TraceRecord &r)
+{
+  ReorderEntry e;
+
+  // fill the window; at the end of the source the buffer drains
+  while ((_heap.size() < _window) && _source->next(e.r)) {
+    if ((_seq > 0) && (e.r.ts < _prev)) _reordered++;
+    _prev = e.r.ts;
+
+    if (_released && (e.r.ts < _last)) {
+      _late++;
+      if (_last - e.r.ts > _max_late) _max_late = _last - e.r.ts;
+    }
+
+    e.seq = _seq++;
+    _heap.push(e);
+  }
+
+  if (_heap.empty())
+    return false;
+
+  r = _heap.top().r;
+  _heap.pop();
+
+  if (!_released || (r.ts > _last)) _last = r.ts;
+  _released = true;
+
+  return true;
+}
+
+void ReorderBuffer::print_stats(ostream &os)
+{
+  os.precision(6);
+  os << "Reorder statistics:" << endl
+     << "  window (records):          " << dec << _window << endl
+     << "  records:                   " << _seq << endl
+     << "  out of order:              " << _reordered << endl
+     << "  too late for the window:   " << _late << endl
+     << "  max. lateness:             " << fixed << to_seconds(_max_late) << endl
+     << endl;
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+/// @brief bounded reordering of trace records
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_REORDER_H__
+#define __CA_TRACE_REORDER_H__
+
+#include <iostream>
+#include <queue>
+#include <vector>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+///@brief record held by a reorder buffer
+typedef struct _reorder_entry {
+  TraceRecord r;                    ///< record
+  uint64 seq;                       ///< arrival number (keeps equal
+                                    ///< timestamps in arrival order)
+
+  /// @brief heap order: later records compare greater
+  bool operator>(const struct _reorder_entry &o) const
+  {
+    return (r.ts > o.r.ts) || ((r.ts == o.r.ts) && (seq > o.seq));
+  };
+} ReorderEntry;
+
+//------------------------------------------------------------------------------
+/// @brief bounded reordering of slightly unsorted traces
+///
+/// ReorderBuffer delivers the records of another source in timestamp order
+/// as long as no record is displaced by more than the window. Traces
+/// collected from per-CPU buffers are typically only slightly out of order,
+/// so a small window sorts them in a single streaming pass. The buffer holds
+/// up to @a window records in a min-heap and releases the earliest one once
+/// it is full. A record that arrives after a later one has been released is
+/// too late for the window; it is delivered next (out of order) and counted.
+///
+class ReorderBuffer : public TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param source unsorted source (not owned)
+    /// @param window number of records held back
+    ReorderBuffer(TraceSource *source, uint32 window);
+
+    /// @brief destructor
+    virtual ~ReorderBuffer(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief read the next record in timestamp order
+    /// @param r (output) record
+    /// @retval true if a record was read, false at the end of the trace
+    virtual bool next(TraceRecord &r);
+
+    /// @brief number of streams of the underlying source
+    virtual uint32 streams(void) const { return _source->streams(); };
+
+    /// @brief name of @a stream of the underlying source
+    virtual const char* name(uint32 stream) const { return _source->name(stream); };
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief number of records that arrived too late for the window
+    uint64 late(void) const { return _late; };
+
+    /// @brief print reordering statistics
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @}
+
+
+  protected:
+    TraceSource *_source;           ///< unsorted source
+    uint32 _window;                 ///< capacity of the buffer (records)
+    priority_queue<ReorderEntry, vector<ReorderEntry>, greater<ReorderEntry> > _heap;
+                                    ///< buffered records, earliest first
+    uint64 _seq;                    ///< records read from the source
+    bool   _released;               ///< true once a record was released
+    simtime _last;                  ///< timestamp of the latest released
+                                    ///< record
+    uint64 _reordered;              ///< records that arrived before an
+                                    ///< earlier record
+    uint64 _late;                   ///< records too late for the window
+    simtime _max_late;              ///< largest delay of a late record
+    simtime _prev;                  ///< timestamp of the previous arrival
+};
+
+#endif // __CA_TRACE_REORDER_H__
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+/// @brief spatial sampling of traces
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+#include "trace_sample.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// SpatialSampler
+//
+SpatialSampler::SpatialSampler(TraceSource *source, double rate, uint32 block_size)
+  : _source(source), _rate(rate), _block_size(block_size > 0 ? block_size : 1),
+    _threshold(threshold(rate)), _records(0), _sampled(0), _first(0),
+    _cursor(0), _split(false)
+{
+}
+
+bool SpatialSampler::next(TraceRecord &r)
+{
+  for (;;) {
+    if (!_split) {
+      if (!_source->next(_record)) return false;
+      if (_records++ == 0) _first = _record.ts;
+      _cursor = _record.address;
+    }
+
+    uint64 end = _record.address + _record.size, size;
+
+    _split = false;
+    if (run(&_cursor, &size, end, _block_size, _threshold)) {
+      r = _record;
+      r.ts = scale(r.ts, _first, _rate);
+      r.address = _cursor;
+      r.size = size;
+      _cursor += size;
+      _split = _cursor < end;
+      _sampled++;
+      return true;
+    }
+  }
+}
+
+uint64 SpatialSampler::hash(uint64 block)
+{
+  // finalizer of splitmix64: consecutive blocks map to unrelated hashes
+  block = (block ^ (block >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  block = (block ^ (block >> 27)) * 0x94d049bb133111ebULL;
+  block = block ^ (block >> 31);
+
+  return block % SAMPLE_MODULUS;
+}
+
+uint64 SpatialSampler::threshold(double rate)
+{
+  if (!(rate > 0.0)) return 0;
+  if (rate >= 1.0) return SAMPLE_MODULUS;
+
+  return (uint64)(rate * SAMPLE_MODULUS + 0.5);
+}
+
+bool SpatialSampler::run(uint64 *address, uint64 *size, uint64 end,
+                         uint32 block_size, uint64 threshold)
+{
+  // a request of size 0 still touches its first block
+  uint64 block = *address / block_size;
+  uint64 last = (max(end, *address + 1) - 1) / block_size;
+
+  while ((block <= last) && (hash(block) >= threshold)) block++;
+  if (block > last) return false;
+
+  uint64 start = max(*address, block * block_size);
+  while ((block <= last) && (hash(block) < threshold)) block++;
+
+  *address = start;
+  *size = min(end, block * block_size) - start;
+  return true;
+}
+
+void SpatialSampler::print_stats(ostream &os)
+{
+  os.precision(6);
+  os << "Sampling statistics:" << endl
+     << "  rate:                      " << fixed << _rate << endl
+     << "  block size:                " << dec << _block_size << endl
+     << "  records:                   " << _records << endl
+     << "  sampled:                   " << _sampled << " ("
+     << (_records > 0 ? (double)_sampled / _records : 0.0) << ")" << endl
+     << endl;
+}
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+/// @brief spatial sampling of traces
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_SAMPLE_H__
+#define __CA_TRACE_SAMPLE_H__
+
+#include <iostream>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+// modulus of the sampling hash; rates are resolved to 1/SAMPLE_MODULUS
+#define SAMPLE_MODULUS  (1ULL << 24)
+
+//------------------------------------------------------------------------------
+/// @brief spatially sampled trace
+///
+/// SpatialSampler passes on the accesses to a pseudo-random subset of the
+/// blocks of the address space: a block is sampled if the hash of its block
+/// number modulo SAMPLE_MODULUS is below rate * SAMPLE_MODULUS. A request is
+/// trimmed to the runs of sampled blocks it touches; a request that touches
+/// several runs is split into one request per run, all with the timestamp of
+/// the original. All accesses to a sampled block are kept, so the reuse
+/// pattern of the sampled blocks is preserved, and the sampled workload
+/// behaves like the full one on a device
+/// whose capacity-dependent parameters (e.g., cache sizes) are scaled by the
+/// rate (see Disk::scale_capacity()). The time since the first request is
+/// scaled by the rate as well, so the sampled requests arrive at the rate of
+/// the full trace and load the device to the same degree. Since the decision
+/// depends only on the address, the sampler works on any stream of requests
+/// in a single pass.
+///
+class SpatialSampler : public TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param source requests (not owned)
+    /// @param rate sampling rate in (0, 1]
+    /// @param block_size sampling granularity (bytes)
+    SpatialSampler(TraceSource *source, double rate, uint32 block_size);
+
+    /// @brief destructor
+    virtual ~SpatialSampler(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief read the next sampled record
+    /// @param r (output) record
+    /// @retval true if a record was read, false at the end of the trace
+    virtual bool next(TraceRecord &r);
+
+    /// @brief number of streams of the underlying source
+    virtual uint32 streams(void) const { return _source->streams(); };
+
+    /// @brief name of @a stream of the underlying source
+    virtual const char* name(uint32 stream) const { return _source->name(stream); };
+
+    /// @}
+
+
+    /// @name sampling
+    /// @{
+
+    /// @brief hash of block number @a block in [0, SAMPLE_MODULUS)
+    static uint64 hash(uint64 block);
+
+    /// @brief hash threshold of sampling rate @a rate
+    static uint64 threshold(double rate);
+
+    /// @brief find the first run of sampled blocks in [@a address, @a end)
+    /// @param address (in/out) start of the search; start of the run
+    /// @param size (output) length of the run, clipped to @a end
+    /// @param end end of the request (bytes)
+    /// @param block_size sampling granularity (bytes)
+    /// @param threshold hash threshold of the sampling rate
+    /// @retval true if a run was found, false if no block is sampled
+    static bool   run(uint64 *address, uint64 *size, uint64 end,
+                      uint32 block_size, uint64 threshold);
+
+    /// @brief timestamp of a sampled request: the time since the first
+    ///        request is scaled by @a rate, so the sampled requests arrive
+    ///        at the rate of the full trace
+    /// @param ts timestamp of the request
+    /// @param first timestamp of the first request
+    /// @param rate sampling rate
+    static simtime scale(simtime ts, simtime first, double rate)
+    {
+      return first + (simtime)((ts - first) * rate);
+    };
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief print the number of sampled requests (a split request counts
+    ///        once per part)
+    /// @param os output stream
+    void   print_stats(ostream &os);
+
+    /// @}
+
+
+  protected:
+    TraceSource *_source;           ///< full trace
+    double _rate;                   ///< sampling rate
+    uint32 _block_size;             ///< sampling granularity (bytes)
+    uint64 _threshold;              ///< hash threshold of the rate
+    uint64 _records;                ///< records read from the source
+    uint64 _sampled;                ///< records passed on
+    simtime _first;                 ///< timestamp of the first record
+    TraceRecord _record;            ///< record being split
+    uint64 _cursor;                 ///< start of the rest of _record
+    bool   _split;                  ///< rest of _record not yet searched
+};
+
+#endif // __CA_TRACE_SAMPLE_H__
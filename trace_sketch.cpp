@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+/// @brief mergeable summary of a replay
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+#include "trace_sketch.h"
+#include "checkpoint.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// TraceSketch
+//
+TraceSketch::TraceSketch(double alpha, uint32 block_size)
+  : _block_size(block_size > 0 ? block_size : 1), _latency(alpha), _blocks(TRACE_SKETCH_HOT)
+{
+}
+
+bool TraceSketch::merge(const TraceSketch &other)
+{
+  if (other._block_size != _block_size) {
+    cout << "Error: cannot merge sketches of different block sizes" << endl;
+    return false;
+  }
+
+  // check both parts first so that a failed merge leaves the sketch intact
+  if ((fabs(other._latency.accuracy() - _latency.accuracy()) > 1e-12) ||
+      (other._blocks.width() != _blocks.width()) ||
+      (other._blocks.depth() != _blocks.depth())) {
+    cout << "Error: cannot merge sketches of different dimensions" << endl;
+    return false;
+  }
+
+  return _latency.merge(other._latency) && _blocks.merge(other._blocks);
+}
+
+bool TraceSketch::save(const char *filename) const
+{
+  ofstream f(filename, ios::binary);
+
+  if (!f.good()) {
+    cout << "Error: cannot create sketch file '" << filename << "'" << endl;
+    return false;
+  }
+
+  f.write(TRACE_SKETCH_MAGIC, 4);
+  ckpt_put(f, (uint32)TRACE_SKETCH_VERSION);
+  ckpt_put(f, _block_size);
+  _latency.save(f);
+  _blocks.save(f);
+
+  if (!f.good()) {
+    cout << "Error: cannot write sketch file '" << filename << "'" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+bool TraceSketch::load(const char *filename)
+{
+  ifstream f(filename, ios::binary);
+  char magic[4];
+
+  if (!f.good()) {
+    cout << "Error: cannot open sketch file '" << filename << "'" << endl;
+    return false;
+  }
+
+  f.read(magic, 4);
+  if (!f.good() || (memcmp(magic, TRACE_SKETCH_MAGIC, 4) != 0)) {
+    cout << "Error: '" << filename << "' is not a sketch file" << endl;
+    return false;
+  }
+
+  if (!ckpt_check(f, (uint32)TRACE_SKETCH_VERSION, "format version") ||
+      !ckpt_get(f, _block_size) || !_latency.load(f) || !_blocks.load(f)) {
+    cout << "Error: cannot read sketch file '" << filename << "'" << endl;
+    return false;
+  }
+
+  return true;
+}
+
+void TraceSketch::print_stats(ostream &os) const
+{
+  vector<pair<uint64, uint64> > hot = _blocks.top();
+
+  os.precision(6);
+  os << "Sketch statistics:" << endl
+     << "  requests:                  " << dec << _latency.count() << endl
+     << "  accuracy:                  " << fixed << _latency.accuracy() << endl
+     << "  p50 latency:               " << to_seconds(_latency.quantile(0.50)) << endl
+     << "  p90 latency:               " << to_seconds(_latency.quantile(0.90)) << endl
+     << "  p99 latency:               " << to_seconds(_latency.quantile(0.99)) << endl
+     << "  p999 latency:              " << to_seconds(_latency.quantile(0.999)) << endl
+     << "  hot blocks (" << _block_size << " bytes):" << endl;
+
+  for (uint32 i = 0; i < hot.size(); i++)
+    os << "    " << setw(16) << hex << hot[i].second * _block_size << dec
+       << setw(12) << hot[i].first << " accesses ("
+       << setprecision(4) << (double)hot[i].first / max(_blocks.total(), (uint64)1) << ")" << endl;
+  os << endl;
+}
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+/// @brief mergeable summary of a replay
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_SKETCH_H__
+#define __CA_TRACE_SKETCH_H__
+
+#include <iostream>
+
+#include "disk.h"
+#include "quantile_sketch.h"
+#include "count_min.h"
+using namespace std;
+
+// sketch file signature and format version
+#define TRACE_SKETCH_MAGIC    "SKCH"
+#define TRACE_SKETCH_VERSION  1
+
+// number of hot blocks tracked
+#define TRACE_SKETCH_HOT      10
+
+//------------------------------------------------------------------------------
+/// @brief bounded-memory summary of a replay
+///
+/// TraceSketch summarizes the requests of a replay in constant memory: a
+/// QuantileSketch of the latencies and a CountMinSketch of the accessed
+/// blocks with the most frequently accessed (hot) blocks. Summaries of
+/// several threads, devices or runs merge into the summary of all their
+/// requests and can be saved to and loaded from a file.
+///
+class TraceSketch {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param alpha relative accuracy of the latency quantiles
+    /// @param block_size granularity of the block counts (bytes)
+    TraceSketch(double alpha=0.01, uint32 block_size=4096);
+
+    /// @brief destructor
+    ~TraceSketch(void) {};
+
+    /// @}
+
+
+    /// @name accumulation
+    /// @{
+
+    /// @brief account a request to @a address with latency @a latency
+    void   add(uint64 address, simtime latency)
+    {
+      _latency.add(latency);
+      _blocks.add(address / _block_size);
+    };
+
+    /// @brief add the requests of @a other
+    /// @retval true on success, false if the configurations differ
+    bool   merge(const TraceSketch &other);
+
+    /// @}
+
+
+    /// @name serialization
+    /// @{
+
+    /// @brief write the summary to @a filename
+    /// @retval true on success, false otherwise
+    bool   save(const char *filename) const;
+
+    /// @brief read a summary written by save()
+    /// @retval true on success, false otherwise
+    bool   load(const char *filename);
+
+    /// @}
+
+
+    /// @name statistics
+    /// @{
+
+    /// @brief print the latency distribution and the hot blocks
+    /// @param os output stream
+    void   print_stats(ostream &os) const;
+
+    /// @}
+
+
+  protected:
+    uint32 _block_size;             ///< granularity of the block counts
+    QuantileSketch _latency;        ///< latencies
+    CountMinSketch _blocks;         ///< accessed blocks
+};
+
+#endif // __CA_TRACE_SKETCH_H__
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+/// @brief sources of trace records
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_SOURCE_H__
+#define __CA_TRACE_SOURCE_H__
+
+#include "disk.h"
+using namespace std;
+
+///@brief request of a trace
+typedef struct _trace_record {
+  simtime ts;                       ///< timestamp
+  uint32 stream;                    ///< source stream of the request
+  char   op;                        ///< operation ('r'/'w')
+  uint64 address;                   ///< starting address (in bytes)
+  uint64 size;                      ///< number of bytes
+} TraceRecord;
+
+//------------------------------------------------------------------------------
+/// @brief base class for sources of trace records
+///
+/// A TraceSource delivers the requests of one or more traces one at a time.
+/// Sources can be stacked to transform a trace on the fly (e.g., to merge
+/// several traces) in front of a replay.
+///
+class TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    TraceSource(void) {};
+
+    /// @brief destructor
+    virtual ~TraceSource(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief read the next record
+    /// @param r (output) record
+    /// @retval true if a record was read, false at the end of the trace
+    virtual bool next(TraceRecord &r) = 0;
+
+    /// @brief number of streams the records are tagged with
+    virtual uint32 streams(void) const { return 1; };
+
+    /// @brief name of @a stream
+    virtual const char* name(uint32 /*stream*/) const { return "trace"; };
+
+    /// @}
+};
+
+#endif // __CA_TRACE_SOURCE_H__
@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+/// @brief synthetic workload generator
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#include "trace_synthetic.h"
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// SyntheticTrace
+//
+SyntheticTrace::SyntheticTrace(uint64 requests, double rate, double read_fraction,
+                               uint64 size, uint64 span)
+  : _requests(requests), _generated(0), _read_fraction(read_fraction),
+    _size(size > 0 ? size : 1), _time(0.0), _rng(SYNTHETIC_SEED),
+    _interarrival(rate > 0.0 ? rate : 1.0), _uniform(0.0, 1.0)
+{
+  _slots = span / _size;
+  if (_slots == 0) _slots = 1;
+}
+
+bool SyntheticTrace::next(TraceRecord &r)
+{
+  if (_generated >= _requests)
+    return false;
+
+  _time += _interarrival(_rng);
+
+  r.ts = to_simtime(_time);
+  r.stream = 0;
+  r.op = _uniform(_rng) < _read_fraction ? 'r' : 'w';
+  r.address = (_rng() % _slots) * _size;
+  r.size = _size;
+  _generated++;
+
+  return true;
+}
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+/// @brief synthetic workload generator
+/// @author Bernhard Egger <bernhard@csap.snu.ac.kr>
+/// @section changelog Change Log
+/// 2026/10/16 created
+///
+/// @section license_section License
+/// Copyright (c) 2016, Bernhard Egger
+/// All rights reserved.
+///
+/// Redistribution and use in source and binary forms,  with or without modifi-
+/// cation, are permitted provided that the following conditions are met:
+///
+/// - Redistributions of source code must retain the above copyright notice,
+///   this list of conditions and the following disclaimer.
+/// - Redistributions in binary form must reproduce the above copyright notice,
+///   this list of conditions and the following disclaimer in the documentation
+///   and/or other materials provided with the distribution.
+///
+/// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+/// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+/// IMPLIED WARRANTIES OF MERCHANTABILITY  AND FITNESS FOR A PARTICULAR PURPOSE
+/// ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER  OR CONTRIBUTORS BE
+/// LIABLE FOR ANY DIRECT,  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSE-
+/// QUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF  SUBSTITUTE
+/// GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+/// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT
+/// LIABILITY, OR TORT  (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY
+/// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+/// DAMAGE.
+//------------------------------------------------------------------------------
+
+#ifndef __CA_TRACE_SYNTHETIC_H__
+#define __CA_TRACE_SYNTHETIC_H__
+
+#include <random>
+
+#include "disk.h"
+#include "trace_source.h"
+using namespace std;
+
+// seed of the generator; synthetic workloads are reproducible
+#define SYNTHETIC_SEED  1
+
+//------------------------------------------------------------------------------
+/// @brief synthetic random workload
+///
+/// SyntheticTrace generates requests of a fixed size at uniformly random,
+/// size-aligned addresses in [0, span). Requests arrive as a Poisson process
+/// with the given rate and are reads with the given probability.
+///
+class SyntheticTrace : public TraceSource {
+  public:
+    /// @name constructor/destructor
+    /// @{
+
+    /// @brief constructor
+    /// @param requests number of requests
+    /// @param rate arrival rate (requests/second)
+    /// @param read_fraction fraction of reads in [0, 1]
+    /// @param size request size (bytes)
+    /// @param span size of the accessed address range (bytes)
+    SyntheticTrace(uint64 requests, double rate, double read_fraction,
+                   uint64 size, uint64 span);
+
+    /// @brief destructor
+    virtual ~SyntheticTrace(void) {};
+
+    /// @}
+
+
+    /// @name records
+    /// @{
+
+    /// @brief generate the next request
+    /// @param r (output) record
+    /// @retval true if a request was generated, false after the last one
+    virtual bool next(TraceRecord &r);
+
+    /// @brief name of the workload
+    virtual const char* name(uint32 /*stream*/) const { return "synthetic"; };
+
+    /// @}
+
+
+  protected:
+    uint64 _requests;               ///< requests to generate
+    uint64 _generated;              ///< requests generated so far
+    double _read_fraction;          ///< fraction of reads
+    uint64 _size;                   ///< request size (bytes)
+    uint64 _slots;                  ///< number of request-sized slots in the
+                                    ///< address range
+    double _time;                   ///< arrival time of the last request (s)
+    mt19937_64 _rng;                ///< random number generator
+    exponential_distribution<double> _interarrival; ///< interarrival times
+    uniform_real_distribution<double> _uniform;     ///< read/write choice
+};
+
+#endif // __CA_TRACE_SYNTHETIC_H__